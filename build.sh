@@ -9,16 +9,47 @@ devkitSMS="${HOME}/sms/devkitSMS-master/"
 SMSlib="${devkitSMS}/SMSlib"
 ihx2sms="${devkitSMS}/ihx2sms/Linux/ihx2sms"
 
+# DEBUG_OVERLAY=1 ./build.sh shows frame timing counters on screen
+# SOLVE_SLICE=n ./build.sh gives the "still winnable?" search n scanlines a frame
+# DEMO_SLICE=n ./build.sh gives the demo's move evaluator n scanlines a frame
+# BOOT_FULL=1 ./build.sh loads every tile before the menu shows, rather than streaming the card faces in
+files="main save rng layout input sched vdp tiles stack position hint solve demo"
+flags=""
+if [ -n "${DEBUG_OVERLAY}" ]
+then
+    files="${files} debug"
+    flags="${flags} -DDEBUG_OVERLAY"
+fi
+if [ -n "${SOLVE_SLICE}" ]
+then
+    flags="${flags} -DSOLVE_SLICE=${SOLVE_SLICE}"
+fi
+if [ -n "${DEMO_SLICE}" ]
+then
+    flags="${flags} -DDEMO_SLICE=${DEMO_SLICE}"
+fi
+if [ -n "${BOOT_FULL}" ]
+then
+    flags="${flags} -DBOOT_FULL"
+fi
+
 rm -r build
 mkdir -p build
 
+echo ""
+echo "Packing tiles..."
+tools/tiles/build.sh > /dev/null || exit 1
+# Tiles from the outline on are only drawn on the background, so may be flipped copies of others
+tools/tiles/build/tiles -f "$(sed -n 's/^#define OUTLINE_CARD *//p' source/patterns.h)" \
+    -o source/patterns_packed.c source/patterns.c || exit 1
+
 echo ""
 echo "Compiling..."
-for file in main save rng
+for file in ${files}
 do
     echo " -> ${file}.c"
     #${sdcc} -c -mz80 --peep-file ${devkitSMS}/SMSlib/src/peep-rules.txt -I ${SMSlib}/src \
-    sdcc -c -mz80 --peep-file ${devkitSMS}/SMSlib/src/peep-rules.txt -I ${SMSlib}/src \
+    sdcc -c -mz80 --peep-file ${devkitSMS}/SMSlib/src/peep-rules.txt -I ${SMSlib}/src ${flags} \
         -o "build/${file}.rel" "source/${file}.c" || exit 1
 done
 
@@ -0,0 +1,116 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "SMSlib.h"
+
+#include "debug.h"
+
+/* Placed after the game's own patterns */
+#define DEBUG_FONT      288
+
+/* The row between the top cards and the tableau is only drawn on by the
+ * "still winnable?" indicator, below the dragon buttons, which is left alone */
+#define DEBUG_ROW       9
+#define INDICATOR_COL   13
+#define INDICATOR_WIDTH 2
+
+uint16_t debug_value [DEBUG_VALUES] = { 0 };
+
+/* Hex digits 0-F, in colour 2 (black) */
+static const uint32_t debug_font [] = {
+    /* 0 */
+    0x00000000,     0x00003800,     0x00004400,     0x00004c00,
+    0x00005400,     0x00006400,     0x00004400,     0x00003800,
+    /* 1 */
+    0x00000000,     0x00001000,     0x00003000,     0x00001000,
+    0x00001000,     0x00001000,     0x00001000,     0x00003800,
+    /* 2 */
+    0x00000000,     0x00003800,     0x00004400,     0x00000400,
+    0x00001800,     0x00002000,     0x00004000,     0x00007c00,
+    /* 3 */
+    0x00000000,     0x00007800,     0x00000400,     0x00000400,
+    0x00003800,     0x00000400,     0x00000400,     0x00007800,
+    /* 4 */
+    0x00000000,     0x00000800,     0x00001800,     0x00002800,
+    0x00004800,     0x00007c00,     0x00000800,     0x00000800,
+    /* 5 */
+    0x00000000,     0x00007c00,     0x00004000,     0x00007800,
+    0x00000400,     0x00000400,     0x00004400,     0x00003800,
+    /* 6 */
+    0x00000000,     0x00001800,     0x00002000,     0x00004000,
+    0x00007800,     0x00004400,     0x00004400,     0x00003800,
+    /* 7 */
+    0x00000000,     0x00007c00,     0x00000400,     0x00000800,
+    0x00001000,     0x00002000,     0x00002000,     0x00002000,
+    /* 8 */
+    0x00000000,     0x00003800,     0x00004400,     0x00004400,
+    0x00003800,     0x00004400,     0x00004400,     0x00003800,
+    /* 9 */
+    0x00000000,     0x00003800,     0x00004400,     0x00004400,
+    0x00003c00,     0x00000400,     0x00000800,     0x00003000,
+    /* A */
+    0x00000000,     0x00003800,     0x00004400,     0x00004400,
+    0x00007c00,     0x00004400,     0x00004400,     0x00004400,
+    /* B */
+    0x00000000,     0x00007800,     0x00004400,     0x00004400,
+    0x00007800,     0x00004400,     0x00004400,     0x00007800,
+    /* C */
+    0x00000000,     0x00003800,     0x00004400,     0x00004000,
+    0x00004000,     0x00004000,     0x00004400,     0x00003800,
+    /* D */
+    0x00000000,     0x00007000,     0x00004800,     0x00004400,
+    0x00004400,     0x00004400,     0x00004800,     0x00007000,
+    /* E */
+    0x00000000,     0x00007c00,     0x00004000,     0x00004000,
+    0x00007800,     0x00004000,     0x00004000,     0x00007c00,
+    /* F */
+    0x00000000,     0x00007c00,     0x00004000,     0x00004000,
+    0x00007800,     0x00004000,     0x00004000,     0x00004000,
+};
+
+
+/*
+ * Load the overlay's font.
+ */
+void debug_init (void)
+{
+    SMS_loadTiles (debug_font, DEBUG_FONT, sizeof (debug_font));
+}
+
+
+/*
+ * Draw the debug values at the left edge of the screen.
+ * The whole row but the indicator is written each time, which also clears
+ * where the values were drawn before the camera moved.
+ */
+void debug_render (uint8_t scroll)
+{
+    uint16_t row [32] = { 0 };
+
+    /* First tile column fully inside the Game Gear's window (x = 48) */
+    uint8_t col = ((uint8_t) (48 - scroll + 7)) >> 3;
+
+    for (uint8_t i = 0; i < DEBUG_VALUES; i++)
+    {
+        uint16_t value = debug_value [i];
+
+        /* Step past the indicator rather than draw over it */
+        if (((uint8_t) (INDICATOR_COL + INDICATOR_WIDTH - 1 - col) & 0x1f) < 3 + INDICATOR_WIDTH)
+        {
+            col = INDICATOR_COL + INDICATOR_WIDTH;
+        }
+
+        for (uint8_t digit = 0; digit < 4; digit++)
+        {
+            row [(col + 3 - digit) & 0x1f] = DEBUG_FONT + (value & 0x0f);
+            value >>= 4;
+        }
+
+        /* Leave a gap between values */
+        col += 5;
+    }
+
+    SMS_loadTileMapArea (0, DEBUG_ROW, row, INDICATOR_COL, 1);
+    SMS_loadTileMapArea (INDICATOR_COL + INDICATOR_WIDTH, DEBUG_ROW, &row [INDICATOR_COL + INDICATOR_WIDTH],
+                         32 - INDICATOR_COL - INDICATOR_WIDTH, 1);
+}
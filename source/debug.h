@@ -0,0 +1,9 @@
+/* Values shown by the debug overlay, as four hex digits each. */
+#define DEBUG_VALUES 4
+extern uint16_t debug_value [DEBUG_VALUES];
+
+/* Load the overlay's font. */
+void debug_init (void);
+
+/* Draw the debug values at the left edge of the screen, for the given camera scroll. */
+void debug_render (uint8_t scroll);
@@ -0,0 +1,430 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "SMSlib.h"
+
+#include "demo.h"
+#include "position.h"
+#include "stack.h"
+
+/*
+ * Attract mode bot: a greedy evaluator that scores every move on the board
+ * and keeps the best, with no look-ahead. It works a step at a time in what
+ * each frame leaves spare, one card per step, so a choice costs a fixed few
+ * hundred cycles a frame however busy the board is.
+ *
+ * Dragons and cards going home score highest, then moves that empty a
+ * column or free a slot, then moves that uncover a card. Parking a card in
+ * a slot, or a dragon in an empty column, scores by what it uncovers, and
+ * the last free slot is kept for a card that goes home. Shuffling a run
+ * that already sits on a good card scores nothing, and a move back to a
+ * position seen lately is never made, so the bot does not go round in
+ * circles.
+ */
+
+/* Stack indices, as in main.c */
+#define STACK_SLOT_1        8
+#define STACK_SNEP          11
+#define STACK_FOUNDATION_1  12
+#define STACKS              15
+
+/* Steps of a choice */
+#define PHASE_HEIGHTS   0
+#define PHASE_CARDS     1
+#define PHASE_DRAGONS   2
+#define PHASE_DONE      3
+
+uint8_t demo_from = DEMO_NONE;
+uint8_t demo_to;
+uint8_t demo_count;
+bool demo_ready = false;
+
+uint8_t demo_lines = 0;
+uint8_t demo_frames = 0;
+uint16_t demo_cost = 0;
+
+static uint8_t phase = PHASE_DONE;
+static uint8_t source;
+static uint8_t depth;
+static uint8_t height [STACKS];
+static uint8_t empty_column;
+static uint8_t empty_slot;
+static uint8_t free_slots;
+
+static uint8_t best_score;
+static uint8_t best_from;
+static uint8_t best_to;
+static uint8_t best_count;
+static uint8_t coin = 0x5a;
+
+static uint8_t frames;
+static uint16_t cost;
+
+
+/*
+ * True if a card may go on another in a column: a number one lower, of
+ * another colour.
+ */
+static bool fits (uint8_t parent, uint8_t card)
+{
+    return (parent & 0x30) != 0x30 && (card & 0x30) != 0x30 &&
+           (parent & 0x30) != (card & 0x30) && (parent & 0x0f) == (card & 0x0f) + 1;
+}
+
+
+/*
+ * True if a foundation takes a card.
+ */
+static bool goes_home (uint8_t card)
+{
+    if (card == 0x33)
+    {
+        return true;
+    }
+    if ((card & 0x30) == 0x30)
+    {
+        return false;
+    }
+
+    for (uint8_t f = STACK_FOUNDATION_1; f < STACKS; f++)
+    {
+        if (height [f] > 0 && (card_value [stack_base [f]] & 0x30) == (card & 0x30))
+        {
+            return height [f] == (card & 0x0f);
+        }
+    }
+
+    return (card & 0x0f) == 0;
+}
+
+
+/*
+ * True if no other colour could still want a card placed on this one.
+ */
+static bool home_safe (uint8_t card)
+{
+    uint8_t others = 0;
+
+    if (card == 0x33 || (card & 0x0f) <= 1)
+    {
+        return true;
+    }
+
+    for (uint8_t f = STACK_FOUNDATION_1; f < STACKS; f++)
+    {
+        if (height [f] >= (card & 0x0f) && (card_value [stack_base [f]] & 0x30) != (card & 0x30))
+        {
+            others++;
+        }
+    }
+
+    return others == 2;
+}
+
+
+/*
+ * True if moving cards between stacks would return to a recent position.
+ * Moves home and dragon stacks can't, as they only add to the foundations.
+ */
+static bool revisits (uint8_t from, uint8_t to, uint8_t count)
+{
+    uint16_t hash = position_hash;
+    uint8_t first = height [from] - count;
+    uint8_t entry = stack_base [from];
+
+    for (uint8_t d = 0; d < first; d++)
+    {
+        entry = card_next [entry];
+    }
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        uint8_t card = card_value [entry];
+
+        hash ^= POSITION_KEY (from, first + i, card) ^ POSITION_KEY (to, height [to] + i, card);
+        entry = card_next [entry];
+    }
+
+    return position_seen (hash);
+}
+
+
+/*
+ * Score moving the card above this one out of the way, by what it
+ * uncovers: a card that goes home, a loose dragon towards its stack, or a
+ * card that has another column to go to. Anything else only makes room.
+ */
+static uint8_t uncover_score (uint8_t below)
+{
+    if (goes_home (below))
+    {
+        return 110;
+    }
+    if ((below & 0x30) == 0x30)
+    {
+        return 60;
+    }
+
+    for (uint8_t to = 0; to < STACK_SLOT_1; to++)
+    {
+        if (height [to] > 0 && fits (stack_top (to), below))
+        {
+            return 50;
+        }
+    }
+
+    return 10;
+}
+
+
+/*
+ * Score parking the card above this one in a slot. The last free slot is
+ * kept for a card that goes home, unless there is nothing else to do.
+ */
+static uint8_t park_score (uint8_t below)
+{
+    return (free_slots > 1 || goes_home (below)) ? uncover_score (below) : 5;
+}
+
+
+/*
+ * Keep a move if it beats the best so far, tossing a coin on a tie.
+ */
+static void consider (uint8_t from, uint8_t to, uint8_t count, uint8_t score)
+{
+    if (score == 0 || (from < STACKS && to < STACKS && revisits (from, to, count)))
+    {
+        return;
+    }
+
+    coin = (coin << 1) | (((coin >> 7) ^ (coin >> 5) ^ (coin >> 4) ^ (coin >> 3)) & 1);
+
+    if (score > best_score || (score == best_score && (coin & 1)))
+    {
+        best_score = score;
+        best_from = from;
+        best_to = to;
+        best_count = count;
+    }
+}
+
+
+/*
+ * Score every move of one card: the card at (depth) in stack (source)
+ * taking the cards above it along.
+ */
+static void weigh_card (void)
+{
+    uint8_t card = stack_card (source, depth);
+    uint8_t below = (depth > 0) ? stack_card (source, depth - 1) : 0xff;
+    uint8_t count = height [source] - depth;
+    bool column = source < STACK_SLOT_1;
+    bool settled = column && depth > 0 && fits (below, card);
+    bool uncovers = column && depth > 0 && !settled;
+
+    if (count == 1 && goes_home (card))
+    {
+        consider (source, DEMO_HOME, 1, home_safe (card) ? 180 : 120);
+    }
+
+    if ((card & 0x30) == 0x30 && card != 0x33)
+    {
+        /* A dragon only moves to make room */
+        if (column && count == 1 && depth > 0)
+        {
+            if (empty_slot != 0xff)
+            {
+                consider (source, empty_slot, 1, park_score (below) + 15);
+            }
+            if (empty_column != 0xff)
+            {
+                consider (source, empty_column, 1, uncover_score (below));
+            }
+        }
+        return;
+    }
+
+    for (uint8_t to = 0; to < STACK_SLOT_1; to++)
+    {
+        if (to != source && height [to] > 0 && fits (stack_top (to), card))
+        {
+            consider (source, to, count, !column ? 90 : (depth == 0) ? 100 : uncovers ? 70 : 0);
+        }
+    }
+
+    if (empty_column != 0xff && empty_column != source)
+    {
+        consider (source, empty_column, count, !column ? 20 : uncovers ? 40 : 0);
+    }
+
+    if (column && count == 1 && empty_slot != 0xff && depth > 0)
+    {
+        consider (source, empty_slot, 1, park_score (below));
+    }
+}
+
+
+/*
+ * Move on to the next card worth weighing: down the run of the current
+ * column, then the top of the next stack that holds a loose card.
+ */
+static void next_card (void)
+{
+    if (source < STACK_SLOT_1 && depth > 0 && fits (stack_card (source, depth - 1), stack_card (source, depth)))
+    {
+        depth--;
+        return;
+    }
+
+    while (++source < STACK_SNEP)
+    {
+        /* Stacked dragons stay put */
+        if (height [source] > 0 && (source < STACK_SLOT_1 || height [source] == 1))
+        {
+            depth = height [source] - 1;
+            return;
+        }
+    }
+
+    phase = PHASE_DRAGONS;
+}
+
+
+/*
+ * Score stacking each kind of dragon, if all four are loose and there is a
+ * slot to take them.
+ */
+static void weigh_dragons (void)
+{
+    uint8_t dragons [3] = { 0 };
+
+    for (uint8_t s = 0; s < STACK_SNEP; s++)
+    {
+        uint8_t top;
+
+        if (height [s] == 0 || (s >= STACK_SLOT_1 && height [s] > 1))
+        {
+            continue;
+        }
+
+        top = stack_top (s);
+        if (top >= 0x30 && top <= 0x32)
+        {
+            dragons [top & 0x0f]++;
+        }
+    }
+
+    for (uint8_t kind = 0; kind < 3; kind++)
+    {
+        bool room = empty_slot != 0xff;
+
+        for (uint8_t s = STACK_SLOT_1; s < STACK_SNEP; s++)
+        {
+            room |= (height [s] == 1 && stack_top (s) == 0x30 + kind);
+        }
+
+        if (dragons [kind] == 4 && room)
+        {
+            consider (DEMO_DRAGONS, 0, kind, 200);
+        }
+    }
+}
+
+
+/*
+ * One step of a choice.
+ */
+static void step (void)
+{
+    uint8_t h;
+
+    switch (phase)
+    {
+        case PHASE_HEIGHTS:
+            h = stack_height [source];
+            height [source] = h;
+
+            if (h == 0 && source < STACK_SLOT_1 && empty_column == 0xff)
+            {
+                empty_column = source;
+            }
+            else if (h == 0 && source >= STACK_SLOT_1 && source < STACK_SNEP)
+            {
+                empty_slot = (empty_slot == 0xff) ? source : empty_slot;
+                free_slots++;
+            }
+
+            if (++source == STACKS)
+            {
+                source = 0xff;
+                phase = PHASE_CARDS;
+                next_card ();
+            }
+            break;
+
+        case PHASE_CARDS:
+            weigh_card ();
+            next_card ();
+            break;
+
+        case PHASE_DRAGONS:
+            weigh_dragons ();
+
+            demo_from = (best_score > 0) ? best_from : DEMO_NONE;
+            demo_to = best_to;
+            demo_count = best_count;
+            demo_ready = true;
+            phase = PHASE_DONE;
+            break;
+    }
+}
+
+
+/*
+ * Choose again from the board as it is now.
+ */
+void demo_restart (void)
+{
+    demo_ready = false;
+    phase = PHASE_HEIGHTS;
+    source = 0;
+    empty_column = 0xff;
+    empty_slot = 0xff;
+    free_slots = 0;
+    best_score = 0;
+    frames = 0;
+    cost = 0;
+}
+
+
+/*
+ * Frame task: carry on weighing up moves until this frame's slice is used.
+ * A step weighs one card, so the slice is overrun by at most one.
+ */
+void demo_run (void)
+{
+    uint8_t start = SMS_getVCount ();
+    uint8_t lines = 0;
+
+    if (phase == PHASE_DONE)
+    {
+        demo_lines = 0;
+        return;
+    }
+
+    while (phase != PHASE_DONE && lines < DEMO_SLICE)
+    {
+        step ();
+        lines = SMS_getVCount () - start;
+    }
+
+    demo_lines = lines;
+    frames++;
+    cost += lines;
+
+    if (phase == PHASE_DONE)
+    {
+        demo_frames = frames;
+        demo_cost = cost;
+    }
+}
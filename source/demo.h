@@ -0,0 +1,26 @@
+/* Scanlines of each frame the demo's move evaluator may use. Build with DEMO_SLICE=n ./build.sh to change it. */
+#ifndef DEMO_SLICE
+#define DEMO_SLICE 16
+#endif
+
+#define DEMO_NONE       0xff    /* demo_from when the evaluator found nothing worth doing */
+#define DEMO_DRAGONS    0xfe    /* demo_from for stacking dragons */
+#define DEMO_HOME       0xfd    /* demo_to for whichever foundation takes the card */
+
+/* The move chosen, once demo_ready: (demo_count) cards from stack (demo_from) to stack (demo_to),
+ * or the dragons of kind (demo_count). */
+extern uint8_t demo_from;
+extern uint8_t demo_to;
+extern uint8_t demo_count;
+extern bool demo_ready;
+
+/* Scanlines used in the last frame, and frames and scanlines the last choice took, for the debug overlay. */
+extern uint8_t demo_lines;
+extern uint8_t demo_frames;
+extern uint16_t demo_cost;
+
+/* Choose again from the board as it is now. Call after each move, with nothing held. */
+void demo_restart (void);
+
+/* Frame task: carry on weighing up moves until this frame's slice is used. */
+void demo_run (void);
@@ -0,0 +1,254 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "hint.h"
+#include "position.h"
+#include "stack.h"
+#include "hint_data.c"
+
+/*
+ * Each line is a solver solution (tools/solver -o), packed as a prefix
+ * code, shortest for the commonest moves:
+ *   0 ccc              column c to its foundation
+ *   10 ccc ddd         top card of column c onto column d
+ *   110 ccc            column c into the first empty slot
+ *   1110 ccc ddd nnn   n + 2 cards of column c onto column d
+ *   11110 kk           dragons of kind k into their slot; kind 3 ends the line
+ *   111110 ss ddd      slot s onto column d
+ *   111111 ss          slot s to its foundation
+ */
+
+uint8_t hint_from = HINT_NONE;
+uint8_t hint_to;
+uint8_t hint_count;
+
+static uint16_t position;   /* Bit offset of the next move in hint_stream */
+
+/*
+ * Board stack for each of the solver's columns and slots. Where the player
+ * has used a different empty column or slot than the line did, the two are
+ * swapped, and the line carries on.
+ */
+static uint8_t stack_map [11];
+
+/*
+ * The last position on the line, and its hint. If the player wanders off and
+ * comes back to it, the line picks up again.
+ */
+static uint16_t line_hash;
+static uint8_t line_from = HINT_NONE;
+static uint8_t line_to;
+static uint8_t line_count;
+
+
+/*
+ * Read (count) bits of the stream, most significant first.
+ */
+static uint8_t read_bits (uint8_t count)
+{
+    uint8_t value = 0;
+
+    while (count--)
+    {
+        value <<= 1;
+        if (hint_stream [position >> 3] & (0x80 >> (position & 7)))
+        {
+            value |= 1;
+        }
+        position++;
+    }
+
+    return value;
+}
+
+
+/*
+ * The board stack of the solver's first empty slot.
+ */
+static uint8_t first_empty_slot (void)
+{
+    for (uint8_t s = 8; s <= 10; s++)
+    {
+        if (stack_height [stack_map [s]] == 0)
+        {
+            return stack_map [s];
+        }
+    }
+
+    return HINT_NONE;
+}
+
+
+/*
+ * Decode the next move into hint_from, hint_to and hint_count.
+ */
+static void read_move (void)
+{
+    hint_count = 1;
+
+    if (!read_bits (1))
+    {
+        hint_from = stack_map [read_bits (3)];
+        hint_to = HINT_HOME;
+    }
+    else if (!read_bits (1))
+    {
+        hint_from = stack_map [read_bits (3)];
+        hint_to = stack_map [read_bits (3)];
+    }
+    else if (!read_bits (1))
+    {
+        hint_from = stack_map [read_bits (3)];
+        hint_to = first_empty_slot ();
+    }
+    else if (!read_bits (1))
+    {
+        hint_from = stack_map [read_bits (3)];
+        hint_to = stack_map [read_bits (3)];
+        hint_count = read_bits (3) + 2;
+    }
+    else if (!read_bits (1))
+    {
+        hint_count = read_bits (2);
+        hint_from = (hint_count == 3) ? HINT_NONE : HINT_DRAGONS;
+
+        /* A slot already holding one of the dragons, as the solver chooses, or else the first empty one */
+        hint_to = HINT_NONE;
+        for (uint8_t s = 8; s <= 10; s++)
+        {
+            if (stack_card (stack_map [s], 0) == 0x30 + hint_count)
+            {
+                hint_to = stack_map [s];
+                break;
+            }
+        }
+        if (hint_to == HINT_NONE)
+        {
+            hint_to = first_empty_slot ();
+        }
+    }
+    else if (!read_bits (1))
+    {
+        hint_from = stack_map [8 + read_bits (2)];
+        hint_to = stack_map [read_bits (3)];
+    }
+    else
+    {
+        hint_from = stack_map [8 + read_bits (2)];
+        hint_to = HINT_HOME;
+    }
+}
+
+
+/*
+ * Note the position as on the line, with the move just read.
+ */
+static void note_line (void)
+{
+    line_hash = position_hash;
+    line_from = hint_from;
+    line_to = hint_to;
+    line_count = hint_count;
+}
+
+
+/*
+ * Choose a deal of a difficulty.
+ */
+uint16_t hint_pick (uint8_t difficulty)
+{
+    /* Without rated deals, any of the seeds rand () gives */
+    if (hint_lines [difficulty] == 0)
+    {
+        return rand ();
+    }
+
+    return hint_seed [hint_first [difficulty] + rand () % hint_lines [difficulty]];
+}
+
+
+/*
+ * Start following the deal's line, if it has one.
+ */
+void hint_start (uint16_t seed)
+{
+    for (uint8_t i = 0; i < 11; i++)
+    {
+        stack_map [i] = i;
+    }
+
+    for (uint16_t line = 0; line < HINT_LINES; line++)
+    {
+        if (hint_seed [line] == seed)
+        {
+            position = hint_line [line];
+            read_move ();
+            note_line ();
+            return;
+        }
+    }
+
+    /* No line: the player has the "still winnable?" search to go on */
+    hint_from = HINT_NONE;
+    line_from = HINT_NONE;
+}
+
+
+/*
+ * Note a move just made, with the cards already in place.
+ */
+void hint_played (uint8_t from, uint8_t to, uint8_t count)
+{
+    if (hint_from == HINT_NONE)
+    {
+        /* Back where the line was left: the stream has not moved on, so neither has the hint */
+        if (position_hash == line_hash)
+        {
+            hint_from = line_from;
+            hint_to = line_to;
+            hint_count = line_count;
+        }
+        return;
+    }
+
+    if (from != hint_from || count != hint_count)
+    {
+        hint_from = HINT_NONE;
+        return;
+    }
+
+    if (hint_to == HINT_HOME)
+    {
+        if (to < 11)
+        {
+            hint_from = HINT_NONE;
+            return;
+        }
+    }
+    else if (to != hint_to)
+    {
+        /* Another empty stack of the same kind is as good: both were empty, so neither is a foundation */
+        if (to >= 11 || (to < 8) != (hint_to < 8) || stack_height [hint_to] != 0 ||
+            (from != HINT_DRAGONS && stack_height [to] != count))
+        {
+            hint_from = HINT_NONE;
+            return;
+        }
+
+        for (uint8_t i = 0; i < 11; i++)
+        {
+            if (stack_map [i] == to)
+            {
+                stack_map [i] = hint_to;
+            }
+            else if (stack_map [i] == hint_to)
+            {
+                stack_map [i] = to;
+            }
+        }
+    }
+
+    read_move ();
+    note_line ();
+}
@@ -0,0 +1,26 @@
+/* Hint button: stored winning lines for a set of deals, followed as the game is played. */
+#define HINT_NONE       0xff    /* hint_from once the player has left the line */
+#define HINT_DRAGONS    0xfe    /* hint_from for stacking dragons */
+#define HINT_HOME       0xfd    /* hint_to for whichever foundation takes the card */
+
+/* The next move along the line: (hint_count) cards from stack (hint_from) to stack (hint_to),
+ * or the dragons of kind (hint_count) into slot (hint_to). */
+extern uint8_t hint_from;
+extern uint8_t hint_to;
+extern uint8_t hint_count;
+
+/* Difficulties to deal at, as rated by the host solver */
+#define DIFFICULTY_EASY     0
+#define DIFFICULTY_NORMAL   1
+#define DIFFICULTY_HARD     2
+
+/* Choose a deal of the given difficulty: one of its rated deals, all of which have lines, or any seed if it has none.
+ * Returns the seed to shuffle the sorted deck with. */
+uint16_t hint_pick (uint8_t difficulty);
+
+/* Start following the line of the deal shuffled with (seed), once it is on the table. Deals without one get no hint. */
+void hint_start (uint16_t seed);
+
+/* Note a move just made, after position_hash has been kept up: the hint moves along the line if it was the hinted
+ * move, and is lost if not, until the player returns to where they left the line. */
+void hint_played (uint8_t from, uint8_t to, uint8_t count);
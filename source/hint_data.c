@@ -0,0 +1,710 @@
+/*
+ * Hint lines: a winning sequence of moves for each deal, generated by
+ *   solver -a -w 2 -k ratings-0-32767.bin -K 56 -o source/hint_data.c
+ * 168 lines, 9450 moves in 7714 bytes (6.5 bits per move).
+ */
+
+#define HINT_LINES 168
+
+/* Lines for easy, normal and hard deals; one with none deals from every seed */
+const uint16_t hint_first [3] = {
+    0x0000, 0x0038, 0x0070
+};
+
+const uint16_t hint_lines [3] = {
+    0x0038, 0x0038, 0x0038
+};
+
+const uint16_t hint_seed [HINT_LINES] = {
+    0x3ac8, 0x1a49, 0x2b06, 0x1f9f, 0x771c, 0x2741, 0x1270, 0x2286,
+    0x50bf, 0x5da7, 0x4976, 0x30a3, 0x1833, 0x706d, 0x0f50, 0x7938,
+    0x76a4, 0x23a8, 0x3979, 0x41f0, 0x39c2, 0x4ceb, 0x0d55, 0x5e67,
+    0x051f, 0x71ca, 0x0192, 0x404d, 0x2aca, 0x6a0f, 0x720d, 0x2b53,
+    0x512e, 0x48da, 0x2a72, 0x254d, 0x0263, 0x44cb, 0x55c3, 0x7671,
+    0x616d, 0x2819, 0x250d, 0x27e5, 0x7c97, 0x501f, 0x7f71, 0x50b5,
+    0x61d1, 0x41a3, 0x4748, 0x7e86, 0x18a4, 0x2d00, 0x2977, 0x3f29,
+    0x0557, 0x688a, 0x7be0, 0x7fa0, 0x1573, 0x2d6c, 0x3ba4, 0x1968,
+    0x6648, 0x4ce7, 0x5d03, 0x0ca2, 0x68c8, 0x10b7, 0x0312, 0x3e51,
+    0x6d88, 0x3dcb, 0x7344, 0x6823, 0x4d7a, 0x197b, 0x61d9, 0x04f4,
+    0x2cff, 0x7259, 0x3cbc, 0x6649, 0x0ad8, 0x5135, 0x353e, 0x0c4d,
+    0x4003, 0x7b85, 0x6d00, 0x22ae, 0x0dea, 0x0dba, 0x38d7, 0x38ab,
+    0x5d5a, 0x6313, 0x4dfa, 0x5013, 0x6b3e, 0x35ad, 0x6d81, 0x35c9,
+    0x1311, 0x43ce, 0x6d03, 0x3dcf, 0x77bf, 0x382a, 0x7fce, 0x7d10,
+    0x1fbb, 0x168d, 0x05d3, 0x3915, 0x3992, 0x4d05, 0x4df2, 0x3aaf,
+    0x5937, 0x0e4d, 0x7553, 0x22fd, 0x2140, 0x3179, 0x405c, 0x5d10,
+    0x180d, 0x2561, 0x2ec3, 0x2039, 0x6e58, 0x2c35, 0x486c, 0x1939,
+    0x0971, 0x1cd0, 0x14df, 0x3aa1, 0x0750, 0x4131, 0x3d27, 0x31f9,
+    0x1a2d, 0x081f, 0x039a, 0x6102, 0x660b, 0x62c2, 0x5bb7, 0x0d03,
+    0x5a0f, 0x0757, 0x64ef, 0x7741, 0x2361, 0x654b, 0x58e2, 0x39f2,
+    0x332e, 0x2176, 0x5f74, 0x1906, 0x210a, 0x0af0, 0x3e5e, 0x7cf1
+};
+
+const uint16_t hint_line [HINT_LINES] = {
+    0x0000, 0x014e, 0x0248, 0x037e, 0x0527, 0x067d, 0x07f8, 0x0925,
+    0x0a77, 0x0bdb, 0x0d4d, 0x0ed8, 0x1074, 0x1195, 0x12ca, 0x1418,
+    0x1560, 0x16b3, 0x182d, 0x1996, 0x1af0, 0x1c67, 0x1dd2, 0x1f4d,
+    0x20cd, 0x224f, 0x23d9, 0x256b, 0x2711, 0x281e, 0x292c, 0x2a4d,
+    0x2b6b, 0x2c8c, 0x2db5, 0x2ed8, 0x3015, 0x314d, 0x327f, 0x33c8,
+    0x3509, 0x3644, 0x377b, 0x38b8, 0x39f4, 0x3b2f, 0x3c7d, 0x3dc3,
+    0x3f0b, 0x4065, 0x41a3, 0x42ec, 0x4436, 0x4599, 0x46ec, 0x4844,
+    0x4985, 0x4adc, 0x4c28, 0x4d6f, 0x4eb3, 0x5004, 0x5154, 0x52a7,
+    0x5414, 0x5583, 0x56d5, 0x5821, 0x5970, 0x5ad5, 0x5c40, 0x5d8f,
+    0x5eda, 0x6042, 0x61a9, 0x6304, 0x645c, 0x65c2, 0x6736, 0x6897,
+    0x6a02, 0x6b6a, 0x6cc7, 0x6e2e, 0x6fa2, 0x710d, 0x7285, 0x73e7,
+    0x7552, 0x76dd, 0x7858, 0x79bc, 0x7b40, 0x7ca4, 0x7e05, 0x7f70,
+    0x80d0, 0x823c, 0x83a9, 0x8520, 0x8698, 0x87ff, 0x897b, 0x8af4,
+    0x8c69, 0x8de4, 0x8f6a, 0x90f1, 0x9273, 0x93e3, 0x9564, 0x96e1,
+    0x9863, 0x99e4, 0x9b6c, 0x9cf0, 0x9e63, 0x9fdf, 0xa169, 0xa2db,
+    0xa44b, 0xa5cd, 0xa753, 0xa8e1, 0xaa6f, 0xabf3, 0xad73, 0xaee8,
+    0xb072, 0xb1fa, 0xb388, 0xb513, 0xb6ac, 0xb835, 0xb9b4, 0xbb49,
+    0xbcda, 0xbe5a, 0xbfe7, 0xc178, 0xc302, 0xc492, 0xc631, 0xc7e8,
+    0xc987, 0xcb27, 0xccbe, 0xce62, 0xd004, 0xd19e, 0xd333, 0xd4b7,
+    0xd65b, 0xd7f9, 0xd991, 0xdb3a, 0xdce0, 0xde93, 0xe03e, 0xe1e0,
+    0xe37e, 0xe522, 0xe6c6, 0xe877, 0xea2a, 0xebdc, 0xed7f, 0xef4c
+};
+
+const uint8_t hint_stream [7714] = {
+    0xab, 0xc0, 0x34, 0x44, 0xf0, 0xf1, 0x62, 0x8a, 0xaf, 0x09, 0x1d, 0xcf,
+    0x83, 0xec, 0x83, 0x14, 0x9d, 0x9b, 0x59, 0x73, 0xc7, 0xe5, 0xe3, 0x22,
+    0x52, 0xdc, 0xf0, 0xf3, 0x09, 0x33, 0x27, 0xde, 0x97, 0x55, 0x65, 0x65,
+    0x61, 0x61, 0x66, 0xfc, 0xf5, 0xec, 0xcf, 0x08, 0x30, 0x63, 0x6e, 0x78,
+    0x76, 0x07, 0xca, 0xaf, 0x0e, 0x61, 0xae, 0x1e, 0x9d, 0x11, 0x88, 0xbb,
+    0xe3, 0xe0, 0x45, 0x40, 0x18, 0x59, 0x88, 0x68, 0x11, 0xbf, 0x2e, 0x7d,
+    0x7b, 0x24, 0xc0, 0x2e, 0x30, 0xdd, 0xcc, 0x5d, 0xe1, 0xe3, 0xae, 0x6b,
+    0xfe, 0x4e, 0xfd, 0x78, 0x55, 0xfe, 0x85, 0xcb, 0xb2, 0x0d, 0xf5, 0xb4,
+    0x44, 0x2e, 0x30, 0xf2, 0xc3, 0xcf, 0x83, 0x44, 0x64, 0x66, 0x73, 0x7b,
+    0x06, 0xf4, 0x81, 0xed, 0xe4, 0xfc, 0x92, 0x00, 0x40, 0xc7, 0xca, 0x73,
+    0x80, 0xcd, 0xfa, 0x61, 0xda, 0x9e, 0xb0, 0x5e, 0x74, 0xa7, 0x00, 0x98,
+    0x3e, 0xad, 0xad, 0x72, 0x8c, 0x6f, 0x38, 0x74, 0x46, 0xa3, 0x4e, 0x70,
+    0x1f, 0x46, 0x50, 0x7f, 0x86, 0x67, 0x08, 0xbe, 0x60, 0x58, 0xf0, 0x62,
+    0xc1, 0xa2, 0x2e, 0x5f, 0xd7, 0x83, 0x03, 0x03, 0xf6, 0x6f, 0x31, 0xe0,
+    0x89, 0x12, 0x16, 0x18, 0x2b, 0xb0, 0x0b, 0x5c, 0x26, 0x0d, 0x5e, 0x8e,
+    0x97, 0xac, 0x15, 0x1c, 0x28, 0xb0, 0x6b, 0x46, 0x86, 0xea, 0x07, 0xcc,
+    0xd5, 0x41, 0x3f, 0x70, 0xb8, 0x77, 0x97, 0x2f, 0xd4, 0x46, 0x8a, 0xf4,
+    0x23, 0xe5, 0x1b, 0xdb, 0x3c, 0x7f, 0x7a, 0x30, 0x0c, 0x21, 0x74, 0xa5,
+    0x47, 0x7f, 0x22, 0xb1, 0xfe, 0x24, 0x0a, 0x52, 0x42, 0x60, 0xde, 0x0a,
+    0x1e, 0x52, 0x68, 0xe8, 0xe7, 0xe8, 0xe7, 0xa8, 0xfa, 0xf1, 0xd4, 0x0e,
+    0xed, 0x76, 0xe1, 0x9b, 0xf8, 0x1e, 0x18, 0x26, 0x0d, 0x7d, 0x28, 0x29,
+    0x9b, 0x1b, 0xfb, 0x85, 0xbc, 0xcb, 0x38, 0xb1, 0xe6, 0x87, 0x44, 0x27,
+    0x3a, 0xc1, 0xe0, 0xe0, 0xc0, 0x11, 0x9c, 0x89, 0x0a, 0x20, 0x55, 0xf9,
+    0x51, 0x42, 0x9d, 0x50, 0xb1, 0x61, 0x16, 0x12, 0x2f, 0xc9, 0x12, 0xf4,
+    0xeb, 0x40, 0x9e, 0x47, 0xd8, 0x0b, 0x0c, 0xa1, 0x74, 0xa2, 0x13, 0xac,
+    0x3d, 0x31, 0xc2, 0x13, 0xb0, 0x5b, 0x30, 0x0c, 0x20, 0x61, 0xf3, 0x33,
+    0xf0, 0xff, 0x27, 0x22, 0xf4, 0xb1, 0x42, 0x93, 0x26, 0x74, 0x69, 0xfd,
+    0x4c, 0x98, 0x54, 0x29, 0x2a, 0x1d, 0x12, 0x37, 0xf7, 0x97, 0xf7, 0x84,
+    0x86, 0xb2, 0x9b, 0xbb, 0xba, 0xff, 0x74, 0x01, 0x3f, 0x70, 0xc3, 0xe1,
+    0xf0, 0x63, 0x11, 0xfd, 0xc8, 0xbe, 0x96, 0x9e, 0x14, 0x09, 0x44, 0xc5,
+    0x21, 0x02, 0x62, 0x76, 0x16, 0x62, 0x7c, 0xcf, 0xa8, 0x1f, 0x17, 0xcc,
+    0x08, 0x59, 0xb1, 0x0f, 0xf7, 0xa0, 0x6f, 0x79, 0xe6, 0x61, 0x80, 0x35,
+    0x72, 0xfe, 0x57, 0x2a, 0xc2, 0x82, 0xc4, 0x45, 0x88, 0xbb, 0xca, 0xcc,
+    0xd0, 0xf1, 0x63, 0x09, 0x0e, 0x64, 0x76, 0x67, 0xe5, 0xf3, 0xcb, 0x0e,
+    0xc1, 0xb7, 0xa7, 0x38, 0x58, 0x6a, 0xe9, 0x52, 0x26, 0x67, 0x01, 0x01,
+    0x01, 0xa0, 0xf3, 0x43, 0xe3, 0xdc, 0x81, 0x23, 0x2c, 0x5d, 0x1d, 0xa6,
+    0x18, 0x65, 0xe4, 0xa0, 0xaa, 0xd7, 0x9d, 0x46, 0x68, 0xb5, 0x6b, 0xf9,
+    0xce, 0x8e, 0xa1, 0x42, 0xe3, 0x51, 0xc2, 0x8f, 0x93, 0xd4, 0x0e, 0x15,
+    0xe0, 0x0e, 0x88, 0xbf, 0x9e, 0x1a, 0x22, 0x28, 0x60, 0xaa, 0x14, 0xaa,
+    0x56, 0xed, 0xc1, 0x84, 0xae, 0x3d, 0x7b, 0x28, 0xfa, 0xfe, 0xe8, 0xe1,
+    0x80, 0x7e, 0xc2, 0x46, 0x61, 0xc8, 0x2c, 0xbc, 0x6d, 0x60, 0xcd, 0x61,
+    0x4c, 0x80, 0x5c, 0x1a, 0xa3, 0xa2, 0xa3, 0x46, 0x34, 0x35, 0x58, 0xc8,
+    0xee, 0x61, 0x58, 0xc3, 0x07, 0xcb, 0x83, 0xc4, 0x43, 0x99, 0x3e, 0x95,
+    0xbf, 0x46, 0x32, 0x74, 0xe8, 0x6e, 0xdc, 0x5f, 0xc8, 0x0f, 0xb8, 0xb1,
+    0x50, 0x8e, 0xa3, 0xed, 0x45, 0x8e, 0x1a, 0x6f, 0xe1, 0xcc, 0xa3, 0x22,
+    0xa3, 0xa6, 0x4e, 0x6b, 0x33, 0x3f, 0xe1, 0x66, 0x45, 0x81, 0x83, 0x02,
+    0x45, 0xfd, 0x90, 0x22, 0x55, 0xf4, 0xe0, 0xed, 0x41, 0xe7, 0xda, 0xe2,
+    0x22, 0x65, 0xe4, 0x59, 0x99, 0xe0, 0x62, 0xa0, 0x67, 0x30, 0xc7, 0xa1,
+    0x14, 0x34, 0xf4, 0xf4, 0x56, 0x8c, 0xf0, 0xdd, 0xd0, 0xb9, 0x7f, 0x51,
+    0x91, 0xf4, 0xfc, 0xa3, 0xf0, 0x48, 0x8a, 0x8e, 0x8e, 0x28, 0x26, 0x0a,
+    0xbe, 0xc8, 0xe0, 0xe1, 0x30, 0x03, 0xc2, 0x23, 0x5f, 0x4b, 0x10, 0x3d,
+    0x28, 0xea, 0x0d, 0x8b, 0x53, 0x27, 0x66, 0x1a, 0xc6, 0x5b, 0xcf, 0x32,
+    0x67, 0x74, 0x4b, 0xc7, 0x35, 0xe2, 0xe7, 0x02, 0xae, 0x1c, 0xdc, 0x4c,
+    0x4c, 0x4c, 0x4c, 0x4c, 0xff, 0x7c, 0x7b, 0x00, 0x18, 0x48, 0x81, 0xd3,
+    0x44, 0xfc, 0x56, 0x96, 0x9e, 0xed, 0x0b, 0x4e, 0x67, 0xeb, 0x3e, 0x8d,
+    0xa1, 0xb4, 0x35, 0x7d, 0x84, 0xf1, 0xfe, 0xc2, 0xe6, 0x6e, 0xb5, 0x6a,
+    0xcb, 0x0b, 0x1c, 0x3f, 0xb2, 0x25, 0xe4, 0x9d, 0x6e, 0x3c, 0x39, 0xfb,
+    0xc7, 0x4d, 0x12, 0x58, 0xbb, 0x01, 0x60, 0xc1, 0xfb, 0x80, 0x58, 0x7d,
+    0x6c, 0x7e, 0x36, 0x22, 0x2f, 0xc1, 0x8e, 0x64, 0xf9, 0x33, 0x57, 0x7f,
+    0xd1, 0x6b, 0x36, 0x86, 0x0c, 0x22, 0x06, 0x64, 0xe8, 0xd2, 0xf1, 0xda,
+    0x58, 0xbd, 0x00, 0xd4, 0x2f, 0x8f, 0x70, 0xf9, 0xf5, 0x63, 0x6b, 0x4d,
+    0x99, 0x97, 0xc4, 0x70, 0xc5, 0xf4, 0x23, 0x8c, 0x23, 0xd0, 0xae, 0x70,
+    0x9f, 0x46, 0x90, 0xc3, 0x9f, 0x5d, 0xc4, 0xa7, 0x9c, 0x3e, 0xe4, 0x5d,
+    0xfa, 0xe3, 0xc8, 0xf0, 0xcc, 0x0b, 0xb9, 0x50, 0xfe, 0x49, 0x58, 0x58,
+    0x58, 0x58, 0x58, 0x48, 0x5f, 0xd8, 0xc7, 0xe3, 0x88, 0xfe, 0xb0, 0x33,
+    0xc0, 0xcf, 0xd8, 0x61, 0x8f, 0x72, 0x3e, 0x46, 0xfc, 0x78, 0xee, 0x4b,
+    0xb3, 0xfe, 0xc3, 0xe4, 0x50, 0x5c, 0x41, 0xe4, 0x47, 0x8e, 0x34, 0x50,
+    0xa1, 0xde, 0xcf, 0x9b, 0x41, 0xd3, 0x22, 0x1a, 0x82, 0x82, 0x82, 0xf9,
+    0x5f, 0x4f, 0xee, 0x4f, 0x55, 0xdb, 0x66, 0x6f, 0xe2, 0x30, 0x95, 0x99,
+    0x3c, 0x8a, 0x6b, 0xd4, 0xfc, 0x5d, 0x1f, 0x32, 0x28, 0xfc, 0xa4, 0x18,
+    0x46, 0x47, 0x4c, 0x45, 0xf7, 0x01, 0xd2, 0x12, 0xce, 0xf9, 0xdd, 0x84,
+    0xcd, 0x01, 0x60, 0xc2, 0x23, 0xc0, 0x9a, 0xd4, 0x28, 0x7b, 0x6c, 0x7d,
+    0x48, 0xe7, 0xe3, 0x77, 0x76, 0xb4, 0xae, 0xaa, 0x53, 0x55, 0xfe, 0x85,
+    0x8d, 0xe5, 0x0f, 0x46, 0xe9, 0x53, 0x9c, 0x5d, 0x0b, 0x48, 0x48, 0x5e,
+    0x21, 0x60, 0x01, 0x07, 0xcc, 0x13, 0x93, 0x21, 0x8a, 0xea, 0x8a, 0xc6,
+    0x8d, 0xcb, 0xff, 0x79, 0x42, 0x02, 0x02, 0x02, 0xf6, 0x2d, 0x45, 0xae,
+    0xaa, 0xbb, 0x76, 0xa1, 0x91, 0x69, 0xa8, 0xbc, 0xc2, 0x75, 0x42, 0xf6,
+    0xde, 0x18, 0x3b, 0xa1, 0x5f, 0x0a, 0x12, 0x04, 0xdf, 0x3b, 0xbe, 0x0f,
+    0x2e, 0x4d, 0xa4, 0xe7, 0xa3, 0x8d, 0xf0, 0x72, 0x25, 0x27, 0x28, 0x4b,
+    0x2a, 0x40, 0x8e, 0xa2, 0xc6, 0xde, 0xf0, 0x08, 0xc9, 0x52, 0x40, 0xc2,
+    0x40, 0x8b, 0xf1, 0xe0, 0xb0, 0x88, 0x11, 0x28, 0xbe, 0x64, 0x45, 0x77,
+    0x42, 0x3e, 0x44, 0xa5, 0xfa, 0xa0, 0xb9, 0x9a, 0x45, 0xf3, 0xe3, 0xb9,
+    0x6e, 0x23, 0xf8, 0x25, 0x1e, 0x34, 0x35, 0x58, 0x54, 0x29, 0x5a, 0xfa,
+    0x6a, 0x1f, 0x1e, 0x51, 0xcb, 0xde, 0x1b, 0x61, 0x04, 0x03, 0xcb, 0x0f,
+    0x93, 0x91, 0x71, 0x02, 0x50, 0xa6, 0xbc, 0x55, 0x57, 0x76, 0x69, 0xb9,
+    0xe3, 0x56, 0xac, 0x96, 0x6d, 0x4d, 0x4b, 0xce, 0xa3, 0x38, 0xda, 0x3f,
+    0x28, 0x0b, 0x08, 0x11, 0xf5, 0x0b, 0xdb, 0x8e, 0xe5, 0x6f, 0xe9, 0xdd,
+    0x00, 0x45, 0x45, 0x45, 0x5b, 0xdd, 0x06, 0x7a, 0x6c, 0xc6, 0xb6, 0x1f,
+    0x5a, 0x99, 0x35, 0xa8, 0xf8, 0xda, 0xaf, 0xf3, 0x42, 0xe9, 0xda, 0x1f,
+    0x3c, 0x31, 0xc0, 0x0f, 0xfa, 0x97, 0xa0, 0x11, 0x98, 0x88, 0x8c, 0x0d,
+    0x4a, 0xf1, 0x02, 0x47, 0xd1, 0x11, 0x00, 0x37, 0xec, 0x10, 0x05, 0x83,
+    0x5d, 0xde, 0xf8, 0x72, 0x05, 0xf7, 0x51, 0x09, 0x86, 0xab, 0xb3, 0x27,
+    0xce, 0xd7, 0xc4, 0xf1, 0xf6, 0xe7, 0xba, 0x57, 0xae, 0xec, 0x09, 0x0e,
+    0x12, 0x7f, 0x0f, 0x0e, 0x41, 0x4b, 0x48, 0x91, 0x19, 0xbb, 0x0c, 0x14,
+    0x3c, 0x20, 0x44, 0x4b, 0xc5, 0x58, 0x74, 0xc1, 0x1f, 0xf5, 0xb0, 0x08,
+    0x81, 0x3f, 0x4f, 0xfa, 0xd4, 0x5e, 0x7d, 0xe7, 0x99, 0xc8, 0x97, 0xe6,
+    0x67, 0x47, 0xa7, 0x8a, 0x04, 0xfd, 0x84, 0xc3, 0x88, 0x18, 0x8a, 0x70,
+    0xc6, 0x53, 0xd5, 0x52, 0xd5, 0xaf, 0xec, 0x2c, 0x87, 0x04, 0x02, 0x22,
+    0xd5, 0xbb, 0x01, 0xb3, 0x7e, 0xf9, 0x83, 0x84, 0x08, 0xb9, 0x02, 0x99,
+    0xaa, 0x53, 0x6b, 0xb7, 0xbd, 0x70, 0x21, 0x34, 0x5f, 0x6a, 0xd0, 0x35,
+    0xea, 0x58, 0xe2, 0x2b, 0x59, 0x1b, 0xdc, 0x0c, 0x45, 0x43, 0xa1, 0x14,
+    0xa9, 0xc6, 0x0e, 0x84, 0xa7, 0xc4, 0x94, 0xc8, 0x94, 0x06, 0x06, 0x16,
+    0x81, 0x38, 0x40, 0x03, 0x10, 0x33, 0x27, 0xf2, 0xe0, 0xf9, 0x81, 0x8d,
+    0x0a, 0x42, 0x07, 0xf4, 0xc6, 0xfe, 0x73, 0xf1, 0x64, 0xc2, 0x8c, 0x17,
+    0x1e, 0xbd, 0x91, 0x4c, 0x69, 0x19, 0xc0, 0x88, 0x10, 0xe8, 0x02, 0x67,
+    0xe5, 0xa8, 0x38, 0xc4, 0x37, 0x0f, 0xc3, 0xb0, 0x90, 0xf9, 0x5a, 0xaa,
+    0xfa, 0x35, 0x67, 0x67, 0x24, 0x72, 0xf0, 0x8e, 0x28, 0xe8, 0xef, 0xec,
+    0x92, 0x72, 0xf1, 0xf0, 0xd6, 0xb1, 0x5f, 0x66, 0xed, 0x47, 0x82, 0x58,
+    0x60, 0x44, 0x54, 0x10, 0xa2, 0xaa, 0xc2, 0x22, 0xc7, 0x8e, 0x1e, 0x44,
+    0x96, 0x44, 0x98, 0xa6, 0xbd, 0x18, 0x9a, 0x23, 0xb7, 0xb2, 0x24, 0x0b,
+    0x3e, 0x78, 0x67, 0x9e, 0x67, 0x46, 0x88, 0x85, 0xfc, 0xcb, 0x09, 0xe5,
+    0x61, 0x2a, 0x16, 0x56, 0x5b, 0xb2, 0x0d, 0x61, 0xc3, 0x1b, 0x8f, 0x0e,
+    0xe6, 0x31, 0x11, 0x62, 0x0c, 0x4c, 0x4c, 0x6d, 0xeb, 0xdb, 0x2d, 0x1a,
+    0x60, 0x03, 0x31, 0x86, 0xaa, 0xcc, 0xcd, 0x0d, 0xf2, 0xe7, 0xb5, 0x5e,
+    0x74, 0x76, 0x63, 0x9e, 0x26, 0x6d, 0x46, 0x8b, 0x6a, 0xd2, 0xde, 0xa3,
+    0x04, 0xee, 0xdf, 0xc7, 0x97, 0x54, 0x52, 0x71, 0x3f, 0x60, 0xcb, 0x86,
+    0x1b, 0x79, 0x60, 0xf9, 0x19, 0xdd, 0xf8, 0xae, 0x53, 0xae, 0x95, 0x2b,
+    0xdb, 0x87, 0xa7, 0xa2, 0x4b, 0x06, 0xe1, 0x80, 0x2f, 0x20, 0x3d, 0x20,
+    0x9b, 0x08, 0x9c, 0x10, 0x44, 0x09, 0xb0, 0x11, 0xaf, 0xbd, 0x9a, 0xc9,
+    0xaf, 0x9f, 0x5d, 0x6a, 0xe3, 0x7a, 0xf0, 0xbf, 0xdf, 0x85, 0x0b, 0x84,
+    0x3e, 0x88, 0x86, 0x46, 0xe8, 0x90, 0x9d, 0xd0, 0x7e, 0xe8, 0x47, 0x88,
+    0x91, 0x1f, 0x82, 0x69, 0x12, 0x29, 0x5f, 0x5e, 0x4c, 0x5b, 0xdd, 0x2e,
+    0x79, 0xe7, 0x3a, 0x7f, 0x90, 0x70, 0xfd, 0x79, 0x54, 0x78, 0x5a, 0x1d,
+    0x3c, 0xca, 0x4b, 0xc8, 0x77, 0x0f, 0xe9, 0x6f, 0x7a, 0xee, 0xc0, 0x02,
+    0xc0, 0x2a, 0x0a, 0x0a, 0x0b, 0xe3, 0xd0, 0x90, 0x89, 0x03, 0x7b, 0x39,
+    0x3a, 0x3c, 0x71, 0xd7, 0xc0, 0xd4, 0x7c, 0x6f, 0x5c, 0xc9, 0x3a, 0x8b,
+    0xd9, 0x72, 0x93, 0xee, 0x83, 0x9f, 0x1e, 0x06, 0x7b, 0xb3, 0x0d, 0xf2,
+    0x78, 0x13, 0xe5, 0x1a, 0x14, 0x1c, 0xdc, 0xdc, 0x0c, 0x58, 0x48, 0x49,
+    0x10, 0x57, 0xd9, 0x60, 0x06, 0xfb, 0xef, 0xe2, 0x9d, 0x29, 0x68, 0x91,
+    0xf9, 0x40, 0x52, 0x36, 0x4c, 0xf6, 0xed, 0x69, 0x3c, 0x7c, 0x58, 0xf9,
+    0x98, 0x00, 0x8f, 0x3a, 0x7a, 0x03, 0x79, 0xd7, 0xbf, 0x3e, 0x85, 0xc1,
+    0xc1, 0x5c, 0x11, 0xc1, 0x1f, 0xda, 0x3e, 0x10, 0x3d, 0x08, 0xcc, 0xf6,
+    0x66, 0x18, 0x1f, 0x9d, 0x99, 0x9f, 0xe7, 0x18, 0x84, 0x70, 0xf9, 0x70,
+    0x7a, 0xad, 0x45, 0x5a, 0xa4, 0xaf, 0xd0, 0xcb, 0xd7, 0x66, 0x3c, 0x79,
+    0x73, 0x34, 0x34, 0x34, 0x34, 0x02, 0x04, 0xf7, 0x26, 0x58, 0x04, 0x1f,
+    0x30, 0x66, 0x35, 0x52, 0x4f, 0x2c, 0xdc, 0x30, 0x82, 0xec, 0x85, 0x87,
+    0x20, 0x2c, 0x38, 0x68, 0x11, 0x03, 0xd9, 0x16, 0xe5, 0x91, 0x45, 0x6a,
+    0xbe, 0x99, 0x91, 0x23, 0x27, 0x4f, 0xc3, 0x33, 0xb3, 0xb3, 0xb8, 0x0a,
+    0x7b, 0x0c, 0x37, 0xf1, 0xe6, 0x07, 0x8b, 0x1c, 0xd1, 0x38, 0x2e, 0x41,
+    0xc8, 0x97, 0x72, 0x25, 0xca, 0xa9, 0x5e, 0x1e, 0xc1, 0x9b, 0xd2, 0xa2,
+    0x40, 0x84, 0x14, 0x1f, 0x14, 0x04, 0xe2, 0xc4, 0x48, 0x64, 0x49, 0x66,
+    0x8c, 0xd9, 0xc5, 0x08, 0x3d, 0xa1, 0x55, 0x66, 0x79, 0x9e, 0x7c, 0x99,
+    0x93, 0xf0, 0x23, 0x45, 0x45, 0xca, 0x08, 0xa9, 0x9e, 0x80, 0xa0, 0x1f,
+    0x16, 0x2a, 0x6b, 0x17, 0xea, 0x6c, 0xd7, 0xae, 0x60, 0x0d, 0x09, 0xe5,
+    0xfd, 0x40, 0x81, 0x89, 0x9a, 0x23, 0x01, 0x27, 0xb1, 0xa8, 0xb8, 0x70,
+    0x51, 0xc3, 0x09, 0x83, 0x98, 0xe0, 0xc6, 0xbd, 0xa8, 0x67, 0xfc, 0xb5,
+    0xc7, 0xe6, 0xe2, 0x37, 0x3e, 0x65, 0x8a, 0xbd, 0x50, 0xd0, 0x3c, 0x50,
+    0x24, 0x20, 0x03, 0xa2, 0xa9, 0xff, 0x4c, 0x7a, 0xa9, 0x51, 0x0f, 0x66,
+    0x6e, 0xf1, 0x77, 0x18, 0x60, 0x1b, 0xbf, 0xec, 0xbe, 0x52, 0x85, 0xf9,
+    0x97, 0x34, 0x3e, 0xa4, 0xa6, 0x67, 0xfd, 0xd1, 0xad, 0x56, 0x57, 0xe5,
+    0x75, 0x43, 0x7a, 0x7f, 0x0d, 0xe7, 0xd2, 0x31, 0x80, 0x2b, 0x11, 0x89,
+    0x19, 0x1a, 0x7b, 0x40, 0xda, 0xcb, 0x66, 0x5b, 0x2e, 0x58, 0xe4, 0x5f,
+    0x1b, 0x2f, 0x23, 0x05, 0x80, 0x35, 0xf7, 0x6e, 0xa9, 0xbd, 0x45, 0x46,
+    0xc6, 0xcc, 0x9f, 0x3a, 0x3b, 0xa7, 0xf4, 0xfc, 0x3a, 0x29, 0x29, 0x29,
+    0x2b, 0x91, 0xa9, 0x1a, 0x92, 0xb7, 0xb2, 0x47, 0x9a, 0xa0, 0xb0, 0x6c,
+    0x44, 0xb8, 0x71, 0x80, 0x43, 0x60, 0x13, 0xfd, 0x80, 0x62, 0x90, 0x27,
+    0x3f, 0xa1, 0x94, 0xd1, 0xd5, 0xf8, 0xc4, 0x68, 0x51, 0x2b, 0x17, 0xc8,
+    0x3c, 0x18, 0x7e, 0xde, 0x3f, 0xab, 0x97, 0x13, 0x40, 0xf7, 0xe1, 0xac,
+    0xf0, 0x00, 0x5d, 0x79, 0xd0, 0x66, 0x7d, 0x51, 0xaa, 0xf9, 0xb9, 0xf2,
+    0x6c, 0xa5, 0xe8, 0x93, 0x95, 0x05, 0x44, 0x8e, 0x63, 0x09, 0xde, 0x8f,
+    0x31, 0x82, 0xa6, 0x73, 0x31, 0x95, 0x2a, 0xb4, 0x69, 0x68, 0xcc, 0x3f,
+    0xde, 0x8c, 0xd7, 0xda, 0x4b, 0xe0, 0x18, 0x60, 0x15, 0x0a, 0xbf, 0xc6,
+    0x9d, 0x18, 0xc2, 0x23, 0xcc, 0xa6, 0x12, 0x04, 0x9c, 0xe1, 0x9d, 0x9f,
+    0x3e, 0xac, 0x2b, 0xa5, 0xab, 0x3a, 0x3d, 0x34, 0x60, 0xcc, 0xf6, 0x61,
+    0x98, 0xc4, 0xc7, 0xf2, 0xe7, 0xd3, 0xf8, 0x3f, 0x6d, 0x05, 0x84, 0x16,
+    0xfd, 0xd0, 0xba, 0x7f, 0xd8, 0x7e, 0xa8, 0x61, 0xc8, 0x6f, 0x24, 0x07,
+    0x0e, 0x0c, 0xdf, 0x0f, 0x83, 0x3b, 0x58, 0x47, 0x7c, 0x8c, 0x44, 0x9c,
+    0x4c, 0x0c, 0xd3, 0xc7, 0xa5, 0x44, 0x81, 0x09, 0xa3, 0x9c, 0x34, 0x12,
+    0x0f, 0x6f, 0x3e, 0x76, 0xb9, 0x9f, 0x56, 0x2b, 0xd7, 0x6d, 0xa5, 0x8b,
+    0x9e, 0x3d, 0x9b, 0x6f, 0xe9, 0x7e, 0xf9, 0x69, 0xe9, 0xe7, 0xbe, 0x9f,
+    0x9a, 0x74, 0x6f, 0xc0, 0x08, 0x18, 0xce, 0x65, 0x76, 0x81, 0xb8, 0xb4,
+    0x3e, 0x04, 0x14, 0x4c, 0xd0, 0xd0, 0xd0, 0xdb, 0xde, 0x94, 0x74, 0x09,
+    0xb3, 0x59, 0xe5, 0x26, 0x5f, 0x96, 0x6d, 0xcf, 0x13, 0x49, 0xcc, 0xce,
+    0x2e, 0x23, 0x98, 0x1e, 0x9e, 0xaf, 0x77, 0x8f, 0x16, 0xf8, 0x3c, 0x0b,
+    0xcb, 0xc4, 0x17, 0x95, 0x51, 0x16, 0x16, 0x01, 0x14, 0x17, 0x12, 0x7f,
+    0x6f, 0x9e, 0x67, 0xa7, 0xcb, 0xd1, 0x10, 0x3f, 0x7f, 0x0a, 0x2e, 0x23,
+    0x1d, 0x98, 0xe8, 0xfe, 0x36, 0x52, 0x92, 0x25, 0xf4, 0xbb, 0x20, 0xdc,
+    0x50, 0xe6, 0x41, 0x9f, 0x04, 0x20, 0xfc, 0xeb, 0xe1, 0x7d, 0x11, 0x31,
+    0x39, 0x38, 0x90, 0x90, 0x97, 0xba, 0x1a, 0x1c, 0xf4, 0x4d, 0x7e, 0x66,
+    0xaa, 0xbf, 0xbd, 0x28, 0xe3, 0x0f, 0x42, 0x3a, 0x93, 0xc6, 0xcb, 0xcb,
+    0xd8, 0x7c, 0xe7, 0x23, 0xfc, 0xb3, 0x1a, 0xbc, 0x18, 0x00, 0xaa, 0xbb,
+    0xc8, 0x92, 0xa3, 0x34, 0xb7, 0x8f, 0x44, 0xa8, 0xa0, 0x8b, 0xec, 0xe5,
+    0x48, 0xb9, 0x31, 0x05, 0xcf, 0x9c, 0x01, 0x39, 0xf1, 0x4b, 0x97, 0x54,
+    0x7a, 0xf0, 0xae, 0xaf, 0x0b, 0x05, 0x10, 0x3e, 0x23, 0x79, 0x03, 0x7a,
+    0xfc, 0x11, 0xeb, 0xc7, 0x7b, 0x1f, 0x1b, 0x16, 0xb0, 0xf3, 0xe9, 0xd5,
+    0x14, 0x94, 0x91, 0x40, 0x94, 0x09, 0x7d, 0xe1, 0x0f, 0xa6, 0x00, 0x50,
+    0x97, 0x0e, 0x67, 0xf8, 0xef, 0x84, 0x87, 0xcb, 0xcb, 0xc4, 0x9d, 0x54,
+    0x6f, 0x52, 0x17, 0xf3, 0xa5, 0x18, 0x71, 0x07, 0xd3, 0x73, 0x20, 0xed,
+    0x2d, 0xd9, 0x41, 0x41, 0x41, 0x13, 0xf8, 0x5e, 0x20, 0x66, 0x7c, 0xa0,
+    0x3f, 0xb0, 0xce, 0x73, 0xd3, 0x2f, 0x4a, 0x31, 0x99, 0x3e, 0xac, 0xfc,
+    0x4d, 0x7c, 0xfc, 0x5c, 0x88, 0x96, 0x13, 0x9c, 0x16, 0x2c, 0x70, 0x7c,
+    0x71, 0xf0, 0xf0, 0x7d, 0x31, 0x4a, 0x14, 0x65, 0x8d, 0x93, 0xe7, 0x45,
+    0x12, 0x03, 0xb2, 0xb2, 0xb2, 0xb3, 0x89, 0x37, 0xb9, 0xdc, 0x03, 0x22,
+    0x00, 0xc2, 0x60, 0xff, 0x37, 0x7f, 0x91, 0xbd, 0xf3, 0xf5, 0xe1, 0x67,
+    0xea, 0xd5, 0x59, 0xd9, 0xcd, 0x8b, 0xf6, 0x17, 0x08, 0x8f, 0x16, 0x0c,
+    0xdf, 0x3a, 0xba, 0x37, 0x08, 0x81, 0x73, 0x6a, 0x14, 0xf3, 0xe9, 0x1b,
+    0xdc, 0xce, 0x72, 0xde, 0x00, 0xf8, 0xe1, 0xd9, 0xac, 0x62, 0x87, 0x9a,
+    0x7c, 0x9d, 0x2f, 0x85, 0x8d, 0xcf, 0x96, 0x81, 0xe6, 0x0f, 0x5e, 0x15,
+    0xe1, 0xc2, 0x0e, 0x14, 0x24, 0x27, 0x60, 0xa8, 0x13, 0xd3, 0xba, 0x8a,
+    0x23, 0xb9, 0xa9, 0xa9, 0x1b, 0x11, 0xaf, 0xb5, 0x8a, 0xe5, 0x46, 0xcc,
+    0xda, 0x6c, 0xd1, 0xd1, 0x91, 0xde, 0x20, 0x70, 0x85, 0x05, 0xeb, 0x0d,
+    0x77, 0x4a, 0xfa, 0x88, 0xb0, 0xa1, 0xfd, 0x8f, 0xc1, 0xc0, 0x18, 0xec,
+    0x5b, 0xe3, 0x6f, 0xe7, 0xd2, 0x29, 0xb3, 0xb9, 0x93, 0x81, 0x00, 0x80,
+    0xfb, 0xc4, 0x62, 0x31, 0x19, 0x1c, 0xfc, 0x91, 0x07, 0xc9, 0x81, 0xc2,
+    0xa1, 0x7e, 0x2c, 0xaf, 0x04, 0x21, 0x42, 0x77, 0xa8, 0x6a, 0xb4, 0xb4,
+    0x48, 0x9c, 0x60, 0xb9, 0xdd, 0xee, 0x3c, 0x58, 0xb7, 0xa6, 0x36, 0x04,
+    0x04, 0x04, 0x02, 0x02, 0x02, 0xf6, 0xf5, 0x4b, 0x74, 0xe7, 0x75, 0xbf,
+    0x2e, 0xb2, 0xc8, 0x8b, 0xe9, 0x41, 0x61, 0x05, 0xe3, 0xd4, 0xd6, 0xcc,
+    0xee, 0x4e, 0x4e, 0x41, 0x11, 0x1f, 0xe6, 0x22, 0x32, 0x53, 0xa1, 0x1c,
+    0x68, 0xa1, 0x44, 0x70, 0x46, 0x56, 0x51, 0xa8, 0x55, 0x0f, 0x6c, 0x09,
+    0x05, 0x29, 0x97, 0x44, 0x3a, 0x21, 0xca, 0x3d, 0x13, 0x22, 0xfc, 0x26,
+    0x82, 0xd9, 0x8b, 0xf5, 0xae, 0xb7, 0xfa, 0xdd, 0x32, 0xbc, 0xdd, 0xc7,
+    0xf0, 0x5a, 0x1e, 0x23, 0x7a, 0xff, 0x1e, 0x95, 0x60, 0xa6, 0x8f, 0xc9,
+    0xb1, 0x31, 0x30, 0x37, 0xbc, 0xb0, 0x00, 0x6c, 0x02, 0xe2, 0xfb, 0xe3,
+    0xf6, 0xe3, 0x0b, 0x06, 0x6b, 0xe7, 0x0f, 0xe8, 0x88, 0xe1, 0xae, 0xc3,
+    0xb8, 0x1e, 0x93, 0x87, 0x11, 0x11, 0x15, 0x35, 0xcb, 0x2b, 0xe2, 0x74,
+    0xd9, 0x19, 0x88, 0x1c, 0xa6, 0x8f, 0xcb, 0x10, 0x38, 0xbf, 0xb7, 0x79,
+    0x0c, 0x71, 0x15, 0xc7, 0xe4, 0xe4, 0x5f, 0xc6, 0x63, 0xf9, 0x59, 0x86,
+    0x33, 0x27, 0xf8, 0xb8, 0xc8, 0xfa, 0x58, 0x2e, 0x8c, 0x51, 0xd2, 0xa1,
+    0x73, 0x82, 0xeb, 0xcc, 0x14, 0x28, 0x1d, 0x9d, 0xbd, 0xa3, 0x32, 0x7f,
+    0x78, 0x47, 0x47, 0x34, 0xf6, 0x8d, 0x43, 0x84, 0x37, 0x10, 0x34, 0x8d,
+    0x8e, 0xc4, 0x7a, 0x91, 0x0b, 0xd7, 0x05, 0xf5, 0xf1, 0xf4, 0x4b, 0x0e,
+    0xf0, 0x3b, 0xb7, 0x0c, 0x03, 0xb7, 0x5d, 0xe3, 0xe9, 0xca, 0x7c, 0xcc,
+    0xcc, 0xfb, 0xc3, 0x2f, 0xe4, 0x90, 0x90, 0xd1, 0x1b, 0xc3, 0x20, 0xa3,
+    0x8a, 0x37, 0xb3, 0xc7, 0x7f, 0x2e, 0xe0, 0x04, 0xb1, 0x9d, 0x30, 0xe3,
+    0x05, 0x0f, 0x46, 0x2e, 0xfe, 0x7f, 0x6e, 0x6b, 0xbb, 0x70, 0xd8, 0xd8,
+    0xb1, 0xf3, 0xc4, 0xfe, 0x76, 0x44, 0x74, 0x7d, 0xe1, 0x7e, 0x9d, 0x7a,
+    0xec, 0xc3, 0x2c, 0x24, 0x9f, 0x85, 0x73, 0x73, 0x73, 0x70, 0x76, 0x7f,
+    0x78, 0x42, 0x02, 0x64, 0x5b, 0x59, 0xd9, 0x5b, 0xb4, 0x70, 0x9b, 0xfc,
+    0x2c, 0x62, 0x86, 0x8a, 0x95, 0x28, 0x7d, 0x48, 0x93, 0xc2, 0x72, 0xa7,
+    0xc9, 0x4c, 0x4d, 0x4f, 0x75, 0x41, 0x5d, 0xcc, 0x40, 0x8a, 0x57, 0xa8,
+    0x0a, 0xa0, 0xa1, 0xf9, 0xe1, 0x5f, 0xd8, 0xc2, 0xc6, 0xca, 0xce, 0xd1,
+    0x22, 0x12, 0xd0, 0x61, 0x9e, 0xcd, 0xd7, 0x25, 0x85, 0xea, 0x42, 0xfc,
+    0x1d, 0xdf, 0xc5, 0xbb, 0x69, 0xc6, 0x28, 0xc9, 0x42, 0xf5, 0x35, 0x06,
+    0x02, 0xa8, 0x8e, 0x8e, 0x8c, 0x8c, 0x92, 0x05, 0x63, 0xe5, 0x80, 0x7d,
+    0xe1, 0x86, 0xbd, 0x28, 0x42, 0xfc, 0x00, 0x3a, 0xcc, 0x28, 0x21, 0x68,
+    0x12, 0xa2, 0xd3, 0xe9, 0x6c, 0xcc, 0xef, 0x0a, 0x11, 0x11, 0xfe, 0x62,
+    0x23, 0xe4, 0x4a, 0x53, 0xd4, 0xc7, 0x76, 0x6f, 0x5c, 0x4c, 0x0c, 0xd4,
+    0xd5, 0x7f, 0x7c, 0x2a, 0xaa, 0xfb, 0xc3, 0x77, 0xdf, 0xc8, 0x7d, 0x5c,
+    0x62, 0x3a, 0x80, 0xa2, 0xb2, 0xb6, 0x4c, 0xdf, 0x07, 0x4a, 0x04, 0xe3,
+    0x07, 0x42, 0x50, 0x38, 0x80, 0x32, 0x85, 0xd4, 0x89, 0x5e, 0x08, 0x87,
+    0xf7, 0x2c, 0xb3, 0xf5, 0x04, 0x13, 0xe7, 0xe1, 0x18, 0x58, 0x58, 0x58,
+    0x98, 0x1b, 0xda, 0xa9, 0x45, 0x4c, 0xd1, 0x77, 0xa3, 0x4d, 0x38, 0xc1,
+    0x7d, 0xd3, 0x94, 0x38, 0x3e, 0x70, 0x19, 0x7e, 0xe7, 0xdd, 0x97, 0xdf,
+    0xb7, 0x1e, 0xb1, 0xf3, 0x17, 0xc8, 0x8e, 0x79, 0x76, 0x6d, 0x9e, 0x1a,
+    0x06, 0x40, 0x89, 0x55, 0xd7, 0xc2, 0x9a, 0x1a, 0x09, 0x89, 0x89, 0xfb,
+    0x75, 0xc3, 0x2c, 0xee, 0xeb, 0xeb, 0xfe, 0xbe, 0x9e, 0x6b, 0xe9, 0x69,
+    0x51, 0xa3, 0x39, 0xe0, 0x6e, 0xed, 0x33, 0x33, 0xc5, 0x91, 0x8d, 0x9d,
+    0xec, 0x47, 0xc6, 0xc8, 0x9c, 0x55, 0xc4, 0x4c, 0xe0, 0x60, 0xc0, 0x1f,
+    0xc2, 0xab, 0x2b, 0x7a, 0x67, 0xf7, 0x86, 0x18, 0xc5, 0x40, 0x84, 0x0f,
+    0x10, 0x6c, 0x99, 0xae, 0x23, 0xfc, 0xf2, 0x86, 0x66, 0x7a, 0x8b, 0x39,
+    0xd3, 0xe8, 0xca, 0x3a, 0xba, 0xd0, 0x54, 0x55, 0xd6, 0x55, 0xde, 0xbb,
+    0x03, 0x01, 0x91, 0x97, 0x82, 0xf4, 0x00, 0x60, 0x68, 0x06, 0x9e, 0xec,
+    0x9a, 0x06, 0x0e, 0x0b, 0x8e, 0x1a, 0xaf, 0x2e, 0x3b, 0xb3, 0xbe, 0xee,
+    0x66, 0xe4, 0xd0, 0xe1, 0x11, 0xce, 0x9f, 0x87, 0xd5, 0xaf, 0x02, 0x8b,
+    0x2b, 0x3e, 0x6c, 0x9f, 0x32, 0xd3, 0x0e, 0x61, 0x79, 0x37, 0x38, 0x10,
+    0x09, 0x3f, 0x54, 0x68, 0x48, 0x82, 0x6c, 0x1e, 0xc1, 0x13, 0x0c, 0x01,
+    0xda, 0xde, 0xcf, 0x11, 0x88, 0xe2, 0xc5, 0x4f, 0x76, 0x3c, 0x2a, 0xf9,
+    0x68, 0x59, 0x69, 0x09, 0x52, 0x48, 0x2e, 0x69, 0x18, 0x48, 0x17, 0x26,
+    0x66, 0xba, 0xf1, 0xde, 0x97, 0x3e, 0x7c, 0x63, 0x43, 0xe8, 0xe7, 0x0c,
+    0x41, 0x09, 0x55, 0xd5, 0xfd, 0xc1, 0xc5, 0xd1, 0xe5, 0x26, 0x59, 0x16,
+    0xb5, 0x5c, 0xeb, 0x9a, 0x9a, 0x33, 0x58, 0x30, 0x0e, 0x5c, 0x7c, 0x2d,
+    0x11, 0x3a, 0xa5, 0x0b, 0xdc, 0x1b, 0xd7, 0x76, 0x62, 0x26, 0x25, 0x05,
+    0x95, 0x28, 0x20, 0xb0, 0xf1, 0x19, 0x1c, 0x2a, 0x4b, 0xeb, 0xc8, 0x97,
+    0xb2, 0xc7, 0x1c, 0x44, 0x60, 0x61, 0xc0, 0x21, 0xfb, 0x82, 0xeb, 0xc2,
+    0x99, 0x0f, 0x58, 0x5c, 0x38, 0x48, 0x4f, 0x99, 0x89, 0xd0, 0xca, 0x74,
+    0x43, 0xcf, 0x5e, 0x2a, 0xec, 0xbc, 0x23, 0x34, 0x84, 0x8c, 0x0d, 0x42,
+    0xb8, 0x99, 0x38, 0x9d, 0x4a, 0x8b, 0x87, 0xbb, 0x4e, 0x84, 0x71, 0x84,
+    0x76, 0xb4, 0x6d, 0x13, 0x11, 0x8f, 0xe8, 0x4a, 0x7e, 0xc6, 0x09, 0x74,
+    0x21, 0x02, 0x33, 0x5a, 0x1a, 0xc5, 0x1e, 0xf0, 0x7a, 0xf0, 0xe5, 0x0a,
+    0x10, 0xd2, 0x91, 0x5d, 0x31, 0x91, 0x9a, 0x9a, 0x3f, 0x22, 0x62, 0xcc,
+    0xce, 0xe4, 0x48, 0xde, 0xc6, 0x7f, 0xbb, 0x2f, 0x88, 0xe2, 0x3c, 0xca,
+    0x98, 0x3d, 0x3e, 0x27, 0x18, 0xba, 0x19, 0x94, 0xbf, 0x92, 0x87, 0xe3,
+    0xc5, 0x1a, 0x59, 0xb3, 0xf3, 0x06, 0xcd, 0xab, 0x14, 0x78, 0x12, 0x1c,
+    0x73, 0xee, 0x53, 0xc3, 0xfa, 0xf1, 0x06, 0x04, 0xc2, 0xc2, 0xc2, 0xc2,
+    0xc2, 0x6d, 0xec, 0x4b, 0x0c, 0x71, 0x1f, 0xe5, 0x8a, 0x81, 0x9d, 0xa3,
+    0xa3, 0xea, 0xc6, 0xaa, 0x2b, 0x63, 0x65, 0x6b, 0xeb, 0x91, 0x39, 0x15,
+    0x0a, 0x4f, 0x1d, 0xe7, 0x87, 0x18, 0x5e, 0x30, 0x60, 0x1c, 0xc1, 0x3e,
+    0x84, 0x23, 0xbf, 0xf3, 0x0b, 0x00, 0x80, 0x82, 0x4c, 0x79, 0xf6, 0xd9,
+    0x16, 0x44, 0x27, 0x8c, 0x74, 0x55, 0x57, 0x62, 0x58, 0x9b, 0xf6, 0xfb,
+    0x7e, 0x3d, 0x77, 0x2f, 0xc3, 0xf2, 0x83, 0xa2, 0x35, 0xd5, 0xea, 0x84,
+    0x2b, 0x09, 0x0b, 0xc4, 0x1b, 0x1e, 0x19, 0x42, 0x01, 0x13, 0x23, 0x0a,
+    0x0c, 0xc4, 0xcc, 0xd1, 0xb2, 0x7a, 0xf2, 0xde, 0xc7, 0x2c, 0xe7, 0x66,
+    0x4c, 0xb7, 0xbc, 0xbc, 0x73, 0xe8, 0xcd, 0xed, 0x3f, 0xcd, 0xd2, 0x74,
+    0xd3, 0xf7, 0xf3, 0x8b, 0x18, 0x42, 0x01, 0x6d, 0x6b, 0xe2, 0x12, 0x23,
+    0xae, 0x9c, 0xe1, 0xec, 0xeb, 0x7e, 0x9a, 0x4b, 0x79, 0xf4, 0xa6, 0x68,
+    0x68, 0x68, 0x68, 0x68, 0xbe, 0xcd, 0xb2, 0xd3, 0x44, 0xfd, 0x90, 0xc8,
+    0x8a, 0x0e, 0xaa, 0xad, 0x4d, 0x41, 0x63, 0x68, 0xd1, 0x67, 0x27, 0x69,
+    0x6f, 0x3a, 0xb1, 0x7b, 0xf1, 0xf5, 0xef, 0x43, 0xbf, 0x3e, 0x67, 0xbb,
+    0x51, 0x6f, 0xe0, 0x3c, 0xc5, 0x7a, 0x11, 0x25, 0x57, 0x57, 0x57, 0x07,
+    0xf6, 0x71, 0xb8, 0x8e, 0x5b, 0x33, 0xd9, 0xc7, 0x44, 0x48, 0x91, 0x49,
+    0xf3, 0x44, 0xcf, 0x93, 0x34, 0x50, 0x9d, 0x30, 0x48, 0x4e, 0x60, 0xda,
+    0x37, 0x4c, 0x10, 0xea, 0xd7, 0xf9, 0xc3, 0x1f, 0x83, 0xa7, 0x08, 0x7c,
+    0xfa, 0x82, 0x03, 0x55, 0x26, 0x46, 0x46, 0x46, 0xf1, 0xed, 0xb8, 0x81,
+    0x4f, 0x67, 0xb3, 0x73, 0xc3, 0xb7, 0x3d, 0xf3, 0xdf, 0x77, 0x3f, 0xc2,
+    0x6e, 0x18, 0xe1, 0x21, 0xf2, 0x32, 0xf2, 0x4d, 0x05, 0x55, 0xc8, 0x0a,
+    0xad, 0x55, 0x78, 0x55, 0x1b, 0xd8, 0x16, 0xe1, 0x95, 0x07, 0x84, 0xf4,
+    0x46, 0xca, 0xca, 0xca, 0xc0, 0xac, 0x0a, 0xde, 0xc5, 0x5c, 0x09, 0xe0,
+    0xe3, 0x79, 0xa1, 0x5f, 0x54, 0xb2, 0xd5, 0xd3, 0xbd, 0x90, 0xd9, 0xbb,
+    0xd1, 0x88, 0x97, 0x22, 0x6a, 0x57, 0x6f, 0x0c, 0x21, 0xf9, 0x1c, 0x2f,
+    0x14, 0x32, 0x32, 0xf1, 0xf2, 0x3e, 0x66, 0x26, 0x7a, 0xb1, 0x4b, 0xe9,
+    0x01, 0x15, 0x8c, 0xdc, 0xdf, 0xd8, 0x3b, 0xab, 0x0c, 0xff, 0x7a, 0x30,
+    0x81, 0xa9, 0x9d, 0xc0, 0x1e, 0x23, 0x0e, 0x20, 0x0f, 0x02, 0x38, 0x82,
+    0x3d, 0x49, 0xa8, 0xf3, 0xc6, 0x99, 0x93, 0x58, 0x30, 0xfa, 0xb8, 0xd8,
+    0xb7, 0x5c, 0x57, 0xf2, 0x57, 0x2f, 0x44, 0xd0, 0x34, 0xe8, 0x86, 0xc2,
+    0xc0, 0xc5, 0xf9, 0xe3, 0xdb, 0x4a, 0x61, 0xae, 0xaa, 0xaa, 0xf0, 0xbf,
+    0x5f, 0x3f, 0x07, 0x0b, 0x30, 0x6f, 0x47, 0x68, 0xde, 0x8a, 0x5a, 0x46,
+    0x33, 0xa2, 0x29, 0x79, 0x76, 0xee, 0x30, 0xf0, 0x77, 0x74, 0xe8, 0x9c,
+    0x88, 0x2e, 0x28, 0xd1, 0x46, 0x0b, 0x99, 0x19, 0x19, 0x19, 0x7e, 0xf9,
+    0xf6, 0x77, 0xbb, 0x6f, 0xe4, 0x6d, 0x6d, 0x65, 0x88, 0x8f, 0xae, 0x3d,
+    0x9b, 0xbe, 0xa7, 0xee, 0x47, 0xc7, 0xf1, 0x04, 0x13, 0xc6, 0x93, 0xa6,
+    0xf4, 0xbd, 0x59, 0xaf, 0x54, 0x61, 0x84, 0x8e, 0x8f, 0xb7, 0xae, 0x53,
+    0x37, 0x37, 0x37, 0x36, 0x8d, 0x10, 0x98, 0x3f, 0xdf, 0x5e, 0xd2, 0x53,
+    0x29, 0x4d, 0xa5, 0x7a, 0x53, 0x2b, 0xd5, 0x55, 0x2a, 0x2d, 0x56, 0xf5,
+    0xcb, 0xfb, 0x5b, 0x5f, 0x03, 0xc8, 0xae, 0x58, 0x71, 0x4f, 0xcf, 0x26,
+    0xe0, 0x80, 0xcd, 0xf9, 0xe1, 0x39, 0xda, 0x08, 0x30, 0x40, 0xe6, 0x07,
+    0x46, 0x7b, 0x42, 0xdf, 0xbe, 0x8d, 0xc0, 0xd0, 0x0d, 0x0c, 0xd3, 0xdc,
+    0x56, 0x3b, 0x34, 0x55, 0xf3, 0x96, 0x7d, 0x98, 0x6a, 0xee, 0x58, 0x73,
+    0x4b, 0x94, 0x72, 0x1e, 0x28, 0xb1, 0xe8, 0x5d, 0x32, 0x0f, 0x22, 0x3b,
+    0x02, 0xdc, 0x32, 0x0e, 0x29, 0x0f, 0xe4, 0xd6, 0xbe, 0x95, 0x60, 0x60,
+    0xe8, 0xfc, 0xbb, 0x93, 0x13, 0x13, 0x13, 0x13, 0x09, 0x89, 0xfb, 0xbc,
+    0x74, 0x82, 0xb3, 0xc7, 0x4d, 0xdd, 0xf9, 0xf0, 0x68, 0x9f, 0xa5, 0xf9,
+    0x8c, 0x7d, 0x3e, 0x31, 0xf5, 0x2b, 0xea, 0xab, 0xbb, 0x0f, 0xcf, 0x9c,
+    0x6c, 0x5b, 0xcc, 0x1f, 0x80, 0x39, 0x09, 0x18, 0x1e, 0x38, 0x48, 0x48,
+    0x11, 0x33, 0x3b, 0x3a, 0xb8, 0x38, 0x3f, 0xb4, 0xc3, 0x78, 0xf1, 0x90,
+    0xe0, 0x87, 0x76, 0x35, 0xa8, 0xe0, 0xcf, 0xa5, 0x38, 0x89, 0x32, 0x0e,
+    0x7c, 0x9d, 0x07, 0x99, 0x1e, 0xed, 0x4b, 0xda, 0xb7, 0x72, 0x2d, 0xd9,
+    0x90, 0xe3, 0xb9, 0xa7, 0xc9, 0xa2, 0xe6, 0x99, 0xd8, 0xf2, 0xd0, 0x84,
+    0x58, 0x58, 0x59, 0x8c, 0xd9, 0xbf, 0xbc, 0x7b, 0xc3, 0x0c, 0x3e, 0x06,
+    0xab, 0xea, 0xba, 0xa2, 0xf5, 0xe7, 0xf9, 0xe1, 0xf2, 0x34, 0x4a, 0x7e,
+    0xdd, 0x5d, 0xf7, 0xb2, 0xdf, 0xc2, 0x40, 0xf0, 0x86, 0x32, 0x74, 0xe2,
+    0xc5, 0x5d, 0xe0, 0xe2, 0x05, 0x55, 0x95, 0x24, 0x48, 0xbc, 0x9a, 0x9a,
+    0x29, 0x22, 0x82, 0x2f, 0xb7, 0x94, 0xe8, 0x46, 0x99, 0x10, 0xc1, 0xc7,
+    0x64, 0x43, 0x03, 0x35, 0x30, 0x61, 0x10, 0x3f, 0xdf, 0xb8, 0x63, 0xf2,
+    0x31, 0xf5, 0x33, 0xe1, 0x55, 0xa5, 0x60, 0xa8, 0xa1, 0x39, 0x41, 0x65,
+    0x60, 0xcc, 0x64, 0x8a, 0x8a, 0x28, 0x1f, 0x90, 0x37, 0x4e, 0x2f, 0xe7,
+    0xde, 0x9b, 0xd0, 0x53, 0xe8, 0x83, 0x09, 0x3e, 0x74, 0x1c, 0x20, 0x01,
+    0x00, 0xb0, 0xee, 0x0f, 0xa1, 0xe1, 0xdc, 0x81, 0x10, 0xc8, 0xc8, 0xcd,
+    0x45, 0xf3, 0x86, 0xad, 0x68, 0x53, 0xbc, 0x2f, 0x5f, 0xe6, 0x81, 0x22,
+    0x86, 0xc5, 0x80, 0x91, 0x1d, 0x1f, 0xf5, 0x19, 0xfc, 0x7b, 0xb4, 0x6c,
+    0x44, 0xe3, 0x06, 0xc7, 0xa6, 0x3d, 0x8a, 0xb5, 0x96, 0xf5, 0x2d, 0x91,
+    0x08, 0x0b, 0xc1, 0x41, 0x41, 0x50, 0x78, 0x88, 0x12, 0x84, 0xe8, 0x02,
+    0x55, 0x2f, 0xc4, 0xd7, 0xcd, 0x72, 0x81, 0x8c, 0x7c, 0x89, 0x49, 0xdd,
+    0x3b, 0xb8, 0x09, 0x19, 0xa3, 0x7b, 0xc3, 0x29, 0x3d, 0xa1, 0x80, 0x20,
+    0xe4, 0xe4, 0xfb, 0x01, 0x75, 0x7d, 0x7c, 0xfc, 0x38, 0xec, 0x0d, 0x0f,
+    0x86, 0xe2, 0x84, 0x77, 0x98, 0x81, 0x58, 0x7a, 0x9f, 0x52, 0x25, 0x3a,
+    0x7c, 0xf1, 0x3e, 0x5c, 0x4d, 0x19, 0x8a, 0xbb, 0x3b, 0x3b, 0x39, 0x22,
+    0x00, 0x38, 0x3f, 0xbc, 0xf3, 0x99, 0xd1, 0x1d, 0xc2, 0x70, 0xfa, 0x11,
+    0x76, 0xef, 0xf1, 0xe9, 0xe8, 0x32, 0x91, 0xe0, 0x84, 0x27, 0x18, 0xb9,
+    0x12, 0x5e, 0xa0, 0x78, 0x87, 0x15, 0xdc, 0x08, 0xf1, 0xf2, 0x60, 0x08,
+    0xd0, 0x20, 0x10, 0x73, 0xd4, 0x68, 0x8b, 0xe1, 0x44, 0xd5, 0x81, 0x19,
+    0xbd, 0x98, 0xa6, 0x10, 0x81, 0x4b, 0x6b, 0xd6, 0x0c, 0x3d, 0x1c, 0x47,
+    0x4a, 0x30, 0x90, 0x26, 0x65, 0x91, 0x24, 0x4e, 0x30, 0x74, 0xa6, 0x33,
+    0xcc, 0xcc, 0xcd, 0x1d, 0x2f, 0x59, 0x3e, 0x4f, 0x88, 0x8b, 0xa7, 0x32,
+    0x81, 0xe2, 0x04, 0x15, 0x1a, 0x2a, 0xb9, 0xaa, 0x12, 0x02, 0x0a, 0x7b,
+    0xb8, 0x77, 0xc3, 0x1c, 0x44, 0xe7, 0x4c, 0xd3, 0xab, 0x1f, 0x03, 0x1f,
+    0x10, 0x36, 0xb1, 0x1c, 0x08, 0xea, 0x06, 0xcc, 0x7f, 0x3b, 0x22, 0xe6,
+    0x85, 0x5f, 0x95, 0x83, 0x08, 0x5e, 0xc0, 0x70, 0xc4, 0x1c, 0xc8, 0x94,
+    0xa2, 0xe5, 0x66, 0x68, 0xd1, 0x85, 0x11, 0x85, 0xbf, 0xbd, 0x7b, 0x3c,
+    0x47, 0x1c, 0x47, 0xfa, 0x67, 0x1a, 0x1a, 0x1f, 0x5e, 0x00, 0xe0, 0xe7,
+    0xa0, 0xe8, 0xf9, 0xc1, 0x53, 0xe5, 0x62, 0x24, 0x24, 0xc8, 0x92, 0x0a,
+    0x06, 0x81, 0x18, 0x56, 0x30, 0x65, 0xbb, 0x11, 0xc6, 0x0b, 0x1b, 0x2b,
+    0x56, 0x07, 0x47, 0x72, 0x54, 0x47, 0x13, 0xf6, 0x8d, 0x0f, 0xc6, 0x8c,
+    0x21, 0x02, 0x1e, 0x23, 0x8d, 0x1d, 0x08, 0xd9, 0xb4, 0x4f, 0x31, 0x98,
+    0x77, 0x05, 0xd8, 0xc2, 0x2e, 0x06, 0x8f, 0x9c, 0x3d, 0x48, 0x50, 0xea,
+    0x05, 0x5d, 0x72, 0xaf, 0x10, 0x64, 0x65, 0x48, 0xc0, 0xc1, 0x01, 0x01,
+    0x01, 0x95, 0xa4, 0x3d, 0x5c, 0xbf, 0x8f, 0x79, 0x49, 0x96, 0x9c, 0xe0,
+    0xce, 0x70, 0xca, 0x4f, 0xa3, 0x16, 0x4d, 0xfd, 0xe0, 0xe0, 0xa0, 0xc2,
+    0x0e, 0xc1, 0x92, 0x3a, 0x47, 0x9a, 0x47, 0xca, 0x2e, 0x89, 0xa5, 0x1a,
+    0x7c, 0x4d, 0x56, 0xa9, 0x78, 0xd1, 0x18, 0x24, 0x4a, 0x4a, 0x4a, 0x49,
+    0x72, 0xf7, 0xbe, 0xbc, 0xb9, 0x27, 0xb4, 0xc2, 0x1a, 0x0f, 0x4e, 0x78,
+    0x19, 0xde, 0x6e, 0xe1, 0x0d, 0xd4, 0x05, 0x56, 0xb7, 0xee, 0x03, 0xb7,
+    0x0c, 0x02, 0x7f, 0xb0, 0x2d, 0x3d, 0x16, 0x3f, 0x3b, 0xa6, 0x18, 0xfa,
+    0x95, 0x22, 0xf3, 0xe1, 0x91, 0x98, 0x20, 0x60, 0xa2, 0xac, 0x5a, 0x4c,
+    0xac, 0x99, 0x84, 0xc8, 0x3d, 0xd5, 0xe3, 0x94, 0x89, 0x48, 0xe5, 0xcd,
+    0x0f, 0x1b, 0x59, 0x34, 0x14, 0xe1, 0xcc, 0xdd, 0xbb, 0x17, 0x16, 0xae,
+    0xb9, 0x75, 0xd1, 0x0a, 0xc5, 0xef, 0x43, 0xcf, 0x9d, 0x1a, 0x77, 0x46,
+    0x9d, 0x11, 0x61, 0x3a, 0xb1, 0xe8, 0x00, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8,
+    0xff, 0xa2, 0x3c, 0x8f, 0xb9, 0x93, 0xcb, 0x33, 0x8b, 0xc4, 0x48, 0xa3,
+    0x79, 0x91, 0x47, 0x43, 0xf3, 0x74, 0x42, 0x48, 0x4f, 0x3d, 0x51, 0xaf,
+    0xaa, 0x5e, 0x35, 0x77, 0x43, 0x7f, 0x0e, 0x4b, 0x2e, 0x52, 0x1d, 0x50,
+    0xb2, 0xe5, 0x4f, 0x70, 0x3a, 0xf0, 0xbc, 0x11, 0x06, 0x66, 0x27, 0x27,
+    0x2f, 0xef, 0x44, 0xa4, 0xbe, 0xd1, 0xb0, 0xc2, 0x0f, 0x78, 0x30, 0x90,
+    0x2a, 0x8e, 0x74, 0x9c, 0xed, 0xc3, 0xb2, 0x70, 0x20, 0x38, 0x83, 0xc2,
+    0x1e, 0xa0, 0x28, 0xbd, 0xc4, 0x78, 0xf0, 0x27, 0x8d, 0x5d, 0x44, 0x91,
+    0x2f, 0x21, 0x03, 0x05, 0x4e, 0x85, 0xd2, 0x8b, 0x26, 0x71, 0x50, 0x50,
+    0x50, 0x5f, 0xe9, 0x8f, 0x5e, 0x3d, 0xd7, 0x2c, 0x6e, 0x38, 0x88, 0xf6,
+    0x22, 0xcf, 0x7b, 0xee, 0x3c, 0x77, 0x25, 0xd4, 0xd9, 0x03, 0xfb, 0xf2,
+    0x7a, 0xaf, 0x0d, 0x79, 0xd1, 0xd4, 0x9e, 0xd4, 0x58, 0xf5, 0xc2, 0x95,
+    0x28, 0x7c, 0x46, 0x0c, 0xef, 0xa0, 0x8b, 0x1e, 0xd4, 0xcb, 0x17, 0x94,
+    0x03, 0x51, 0x51, 0x51, 0x51, 0x2f, 0x64, 0xc4, 0xf8, 0x6f, 0xbd, 0xc5,
+    0xdf, 0x0e, 0x20, 0xc3, 0xf6, 0x1e, 0x43, 0x22, 0xb2, 0x63, 0x83, 0xa0,
+    0xe7, 0x0f, 0x42, 0xbc, 0x71, 0x0c, 0x52, 0xc2, 0x7a, 0x67, 0xe8, 0xe6,
+    0x70, 0x61, 0xc7, 0x81, 0x1f, 0x50, 0x39, 0x55, 0x79, 0x53, 0x71, 0x70,
+    0x70, 0x27, 0x05, 0x7f, 0x67, 0x55, 0x86, 0xaa, 0xab, 0x7b, 0xbd, 0xc7,
+    0x2e, 0x24, 0x3b, 0xe3, 0x5f, 0x3b, 0xdc, 0x09, 0xff, 0x47, 0xc1, 0xbe,
+    0xc5, 0x79, 0xe3, 0xdc, 0x60, 0x94, 0x84, 0x27, 0x38, 0xba, 0x2a, 0x93,
+    0x14, 0xe9, 0xf0, 0xfc, 0x40, 0xda, 0x31, 0x13, 0x92, 0x39, 0x38, 0xb8,
+    0x01, 0x13, 0x91, 0xbf, 0xb2, 0x4c, 0xb4, 0x4d, 0xde, 0x7e, 0xaf, 0xba,
+    0x17, 0xcf, 0x1f, 0x15, 0x02, 0x01, 0x07, 0xc9, 0xa8, 0x2e, 0x20, 0x72,
+    0x03, 0xc0, 0xf3, 0x28, 0xe8, 0xaa, 0x7c, 0xce, 0x5b, 0xb3, 0x71, 0xee,
+    0xc5, 0x9c, 0x38, 0x63, 0x31, 0x41, 0x38, 0x6e, 0xce, 0xce, 0xce, 0xce,
+    0x1f, 0xde, 0x81, 0x7d, 0x92, 0x84, 0x5c, 0x99, 0x45, 0xdc, 0xe1, 0x11,
+    0x8c, 0x40, 0xa2, 0x9c, 0x0f, 0x38, 0x4e, 0x23, 0x81, 0x1d, 0x00, 0xd7,
+    0x84, 0x15, 0x2b, 0x0b, 0xc6, 0x9b, 0x9f, 0x0e, 0x6e, 0x6a, 0x89, 0xfb,
+    0x03, 0x2f, 0xd5, 0x19, 0x52, 0x4c, 0x24, 0x0a, 0xc9, 0xbc, 0xfe, 0xad,
+    0x0f, 0xa4, 0x01, 0x4f, 0x6b, 0x2b, 0x86, 0x52, 0xa5, 0x97, 0x54, 0x57,
+    0xe1, 0x6f, 0x77, 0xf4, 0xb7, 0x77, 0x82, 0x00, 0x0f, 0xd8, 0x88, 0xfe,
+    0x5d, 0x48, 0xf7, 0x4f, 0x8f, 0x03, 0x1f, 0xcc, 0x8c, 0xcf, 0xf8, 0x8b,
+    0xf6, 0x5f, 0x08, 0x8b, 0xa8, 0x1b, 0x06, 0xf5, 0xe7, 0xc1, 0x22, 0x09,
+    0x38, 0x93, 0x91, 0xbf, 0xbe, 0x18, 0x52, 0xe1, 0x88, 0x8f, 0xe3, 0x67,
+    0x3d, 0xa5, 0x1a, 0x02, 0x34, 0x67, 0x66, 0x39, 0xe4, 0x7d, 0x58, 0x55,
+    0xed, 0xdf, 0x3c, 0x6a, 0xfd, 0x48, 0x78, 0x27, 0x76, 0x96, 0xec, 0x04,
+    0x0d, 0x94, 0x14, 0x57, 0x20, 0x2c, 0x59, 0xde, 0x14, 0x1e, 0x46, 0xe3,
+    0xcb, 0xab, 0x0b, 0x80, 0xbf, 0xb0, 0x48, 0x3b, 0x3d, 0x31, 0x14, 0x8c,
+    0xdd, 0xfa, 0x70, 0x83, 0x09, 0x17, 0xdc, 0x97, 0xe7, 0xd1, 0xf7, 0x0f,
+    0x87, 0x81, 0x21, 0xf0, 0x72, 0x22, 0x71, 0x71, 0x77, 0x8a, 0x1b, 0x97,
+    0xf8, 0xf8, 0xfc, 0x9c, 0x3e, 0x87, 0x20, 0x2a, 0x97, 0x2b, 0x2f, 0x26,
+    0xc0, 0x1f, 0x9e, 0x01, 0x7d, 0x7b, 0x05, 0x81, 0xe3, 0xc6, 0x1d, 0xd9,
+    0xbc, 0x8c, 0xc4, 0x4f, 0x1f, 0x83, 0xd0, 0xad, 0x11, 0x0f, 0xe2, 0x65,
+    0x29, 0x29, 0xf3, 0x35, 0x5e, 0x70, 0x79, 0xf5, 0x3b, 0xb7, 0x86, 0x41,
+    0x8d, 0x8b, 0xa5, 0x43, 0xa1, 0x49, 0xc8, 0xbb, 0x46, 0x02, 0x57, 0x37,
+    0x75, 0x41, 0x41, 0x4f, 0x79, 0x16, 0xbe, 0x20, 0xf5, 0x55, 0x2f, 0xc8,
+    0x58, 0x78, 0x39, 0x5a, 0x2a, 0x3d, 0x29, 0x50, 0xe3, 0x2e, 0xdf, 0x9f,
+    0x47, 0xf5, 0x6d, 0x7b, 0xe7, 0x2b, 0xd9, 0x4d, 0x99, 0x7a, 0xe0, 0xbd,
+    0xa9, 0x9e, 0x3f, 0xec, 0x22, 0x3d, 0x45, 0x88, 0x3f, 0x92, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0xf6, 0x39, 0x6f, 0x7c, 0xfb, 0xf6, 0xe2, 0xc1, 0x81,
+    0x3b, 0xe3, 0x1f, 0xd8, 0xa6, 0x82, 0xe3, 0xa4, 0x57, 0x22, 0x68, 0x7b,
+    0x40, 0xdd, 0x31, 0xf4, 0x42, 0x04, 0x90, 0x51, 0x9d, 0x83, 0x68, 0x6a,
+    0x1a, 0xcb, 0x0a, 0xe5, 0x21, 0x01, 0x01, 0x06, 0x81, 0x0f, 0xc9, 0xa3,
+    0x19, 0x9f, 0x1e, 0x4c, 0x3d, 0xb8, 0x4b, 0x57, 0x65, 0x26, 0x52, 0x9d,
+    0x10, 0x44, 0xb2, 0xc0, 0x34, 0xe7, 0x01, 0xc1, 0x84, 0xb7, 0x30, 0x0e,
+    0x7a, 0x0c, 0x11, 0x19, 0x19, 0xa4, 0x0a, 0xea, 0xf1, 0xff, 0x0e, 0x2f,
+    0x0a, 0x85, 0xf0, 0xb1, 0x83, 0x1b, 0xf1, 0xfd, 0x58, 0x58, 0xd9, 0x79,
+    0x61, 0x57, 0x0f, 0x78, 0xc8, 0x68, 0x99, 0xcc, 0x1a, 0x08, 0x70, 0x83,
+    0xa5, 0x34, 0x13, 0x87, 0xf0, 0xe2, 0xc7, 0x77, 0xf9, 0x7b, 0xb8, 0xf0,
+    0x62, 0xc5, 0xbc, 0xb2, 0xac, 0x24, 0xf9, 0xad, 0x9d, 0x72, 0xda, 0xfd,
+    0x6a, 0xe5, 0xc6, 0xa5, 0x49, 0xcc, 0xda, 0x14, 0x0c, 0xda, 0x43, 0xd7,
+    0x8f, 0x7b, 0xbe, 0xf7, 0x8f, 0x68, 0xd2, 0xfd, 0x31, 0xca, 0x44, 0xa4,
+    0x28, 0x93, 0x81, 0x10, 0x80, 0xc9, 0x15, 0x68, 0xc4, 0x76, 0x5c, 0xb0,
+    0xf8, 0x59, 0xcd, 0x1a, 0xf4, 0xa3, 0x8c, 0x12, 0x3d, 0x61, 0x8a, 0xec,
+    0x83, 0x0f, 0xa8, 0x38, 0xa1, 0xf2, 0xbe, 0x10, 0x90, 0x90, 0x90, 0x90,
+    0x93, 0xdd, 0x3d, 0x3d, 0x2a, 0x77, 0xa7, 0x2b, 0xa7, 0x4e, 0x40, 0x4e,
+    0x65, 0x97, 0x86, 0x9a, 0x33, 0x5e, 0xb1, 0x54, 0x5c, 0xd7, 0xd4, 0xa8,
+    0x20, 0xd0, 0xa7, 0x18, 0x07, 0x81, 0x30, 0xa1, 0xc6, 0xae, 0x80, 0xa7,
+    0x08, 0xa1, 0x22, 0x27, 0x22, 0xfc, 0xfa, 0x60, 0x44, 0x54, 0x54, 0x54,
+    0x54, 0x5f, 0x69, 0x99, 0x88, 0xe7, 0x3f, 0x9f, 0x76, 0x3c, 0x0b, 0x6d,
+    0xcf, 0x0e, 0xc0, 0xd9, 0xfd, 0x6c, 0xbb, 0x21, 0xcb, 0x1f, 0x25, 0xc3,
+    0x98, 0x39, 0x7e, 0xe9, 0xbd, 0xf4, 0x3c, 0x1c, 0x08, 0x7f, 0x31, 0x44,
+    0x72, 0x03, 0x81, 0x35, 0x1e, 0xa2, 0x2a, 0x15, 0x41, 0x81, 0x18, 0x51,
+    0x84, 0x8c, 0x48, 0xfd, 0x84, 0x8f, 0x14, 0x29, 0x53, 0xa9, 0x17, 0x59,
+    0xf2, 0x6b, 0x22, 0xe2, 0x8f, 0x2a, 0xb7, 0xf9, 0x5b, 0xb8, 0xf5, 0x4b,
+    0x9d, 0x7e, 0x2b, 0xd6, 0x54, 0xb7, 0xeb, 0xda, 0xf7, 0x42, 0xbf, 0xd5,
+    0x2a, 0x5a, 0x30, 0x34, 0xed, 0xab, 0x43, 0x04, 0x40, 0xff, 0x79, 0x22,
+    0x72, 0x57, 0x25, 0x72, 0x57, 0xf6, 0x28, 0xd8, 0x61, 0xa2, 0x51, 0xdd,
+    0xfc, 0x7d, 0x98, 0x3f, 0x12, 0x13, 0x9c, 0x1d, 0xe0, 0xa7, 0xa6, 0xc4,
+    0x7e, 0xb6, 0x7e, 0x0c, 0xdc, 0xe4, 0xe8, 0x7b, 0x10, 0xdc, 0x61, 0x19,
+    0x1b, 0xec, 0x8b, 0xd5, 0x0a, 0x74, 0x41, 0x2d, 0x1a, 0x58, 0xbe, 0x97,
+    0x9a, 0x85, 0x01, 0x46, 0x72, 0x5f, 0x6b, 0x05, 0x15, 0x52, 0xa3, 0xca,
+    0x8c, 0x3a, 0xa1, 0x8e, 0xab, 0x6b, 0x64, 0xcd, 0xf2, 0xb4, 0x42, 0xa1,
+    0xfa, 0x3a, 0x27, 0x18, 0x44, 0xbf, 0xbd, 0x19, 0x40, 0xc3, 0x4a, 0x7c,
+    0x8a, 0x2c, 0x6e, 0x5d, 0x88, 0x24, 0x27, 0xbc, 0x1a, 0x24, 0x18, 0x24,
+    0x84, 0xa1, 0x11, 0xbf, 0xe7, 0x9f, 0x7b, 0xdb, 0xb2, 0xe2, 0x22, 0x36,
+    0xf8, 0xf7, 0x21, 0xd2, 0x8b, 0xe3, 0x53, 0x68, 0x8d, 0x09, 0xf2, 0xb1,
+    0x1b, 0x16, 0x6b, 0xe7, 0x74, 0xfd, 0x18, 0x18, 0x48, 0x7c, 0x24, 0x09,
+    0x25, 0x08, 0xbe, 0x94, 0x17, 0x20, 0x31, 0x91, 0x20, 0x81, 0x98, 0xf3,
+    0xe9, 0x7c, 0x18, 0x8a, 0x7b, 0x26, 0xc3, 0x1d, 0x13, 0xf2, 0x53, 0xa2,
+    0x09, 0x88, 0xc5, 0x4b, 0x72, 0x27, 0xb2, 0x16, 0x36, 0xac, 0x5f, 0xd1,
+    0xd2, 0xa5, 0x63, 0xc7, 0x11, 0xea, 0x4e, 0x55, 0x4b, 0x57, 0xea, 0xe9,
+    0xff, 0x79, 0xd1, 0x87, 0x8f, 0x2f, 0x11, 0x15, 0x05, 0x31, 0x38, 0x6e,
+    0xc4, 0xc4, 0xc2, 0x82, 0xa0, 0xbe, 0xe1, 0x3a, 0x31, 0x96, 0x59, 0x49,
+    0x97, 0xe3, 0xc1, 0x4b, 0xc1, 0x06, 0xde, 0xa2, 0xf9, 0x87, 0x14, 0x30,
+    0x51, 0xd1, 0x5d, 0x88, 0x6e, 0x40, 0x17, 0x04, 0x42, 0x20, 0x7f, 0x66,
+    0x4e, 0x63, 0x93, 0x37, 0x4e, 0x7b, 0x5f, 0x78, 0x7a, 0xea, 0xf5, 0x24,
+    0x13, 0x03, 0x03, 0x04, 0xf2, 0xc0, 0xde, 0xde, 0x08, 0x03, 0x00, 0x98,
+    0x3d, 0x34, 0xf3, 0x6f, 0xf1, 0xb1, 0xf1, 0x70, 0xe8, 0xf1, 0x9c, 0xb0,
+    0x95, 0x96, 0x28, 0xe1, 0x99, 0x8c, 0xec, 0x4b, 0x27, 0x5c, 0x3b, 0x42,
+    0xdc, 0x69, 0xb1, 0x60, 0xa0, 0xeb, 0xd2, 0xbf, 0xe7, 0xa8, 0x4e, 0x80,
+    0x40, 0xd1, 0x55, 0xab, 0x8b, 0x83, 0x93, 0x9a, 0x7b, 0x79, 0xee, 0xcc,
+    0x34, 0xb4, 0xd7, 0x3a, 0x31, 0x18, 0xbc, 0x71, 0xea, 0x4a, 0xc8, 0x91,
+    0x17, 0x14, 0xb9, 0x37, 0x53, 0x54, 0xa6, 0x7f, 0xc6, 0x73, 0xbc, 0xc8,
+    0xae, 0x9d, 0xdf, 0xb9, 0x1e, 0xa2, 0x86, 0xc5, 0xa8, 0xe9, 0xa1, 0xfc,
+    0xd3, 0x21, 0x0c, 0x10, 0x30, 0xb0, 0x0b, 0x09, 0xb7, 0x8f, 0x71, 0x03,
+    0xc3, 0x80, 0xa6, 0xec, 0x86, 0xbc, 0xb1, 0xcb, 0xb7, 0x5b, 0x33, 0x39,
+    0x47, 0x7d, 0x1e, 0xe4, 0x66, 0x6c, 0x31, 0xd6, 0xf3, 0xc6, 0x71, 0x77,
+    0x6e, 0x23, 0xdc, 0x87, 0xe3, 0xc7, 0xc9, 0xe6, 0x47, 0x76, 0x76, 0xbe,
+    0x7f, 0x10, 0xe1, 0xea, 0x20, 0x4d, 0x57, 0xf0, 0x08, 0x4c, 0xd2, 0x83,
+    0xcf, 0xbc, 0xe7, 0xb3, 0x9e, 0xbe, 0xde, 0x66, 0x9f, 0x8b, 0x03, 0x17,
+    0x17, 0x19, 0xd9, 0xae, 0xe4, 0x3c, 0xe1, 0xf4, 0x61, 0x3f, 0xa4, 0x75,
+    0xf5, 0xe6, 0x8a, 0x85, 0x21, 0x00, 0x3e, 0x4f, 0x85, 0x88, 0x8c, 0xe4,
+    0x01, 0x4d, 0x1c, 0x38, 0x73, 0xa8, 0xd9, 0x89, 0xd4, 0x15, 0x14, 0x54,
+    0x54, 0x4f, 0xdc, 0xf4, 0xfc, 0x7f, 0x6e, 0x30, 0x0c, 0xcd, 0xec, 0xed,
+    0xdb, 0x0f, 0x11, 0xc3, 0xf0, 0x79, 0x91, 0x76, 0xe4, 0xf0, 0x5c, 0x88,
+    0xa2, 0x4a, 0x8a, 0xad, 0x54, 0xd6, 0x2c, 0x46, 0x37, 0x96, 0x35, 0x34,
+    0xa8, 0x6e, 0xce, 0x2c, 0x28, 0x32, 0x36, 0x6d, 0x79, 0x7c, 0xfe, 0x8f,
+    0xf3, 0xcf, 0xb9, 0xea, 0x6e, 0x98, 0x61, 0x09, 0x0d, 0x9f, 0x99, 0xfe,
+    0xf4, 0x4b, 0x94, 0x9c, 0x87, 0x30, 0x3a, 0x31, 0x4d, 0xda, 0x56, 0x24,
+    0x50, 0x82, 0xe8, 0x82, 0x01, 0xc1, 0xc4, 0x72, 0x86, 0xcb, 0xae, 0x1d,
+    0x99, 0xb4, 0x8e, 0x8c, 0x14, 0xa9, 0x55, 0x74, 0x7f, 0x48, 0xfe, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x3d, 0x89, 0xb2, 0xac, 0x7f, 0x78, 0x30, 0xc0,
+    0x32, 0x8a, 0xe4, 0x47, 0x97, 0x8f, 0x91, 0x8c, 0xef, 0x47, 0x4e, 0x7a,
+    0xc2, 0xa3, 0x0b, 0x0b, 0x31, 0xe2, 0x4f, 0x98, 0x06, 0x90, 0x51, 0x74,
+    0x69, 0xde, 0x17, 0x29, 0xaa, 0x74, 0x3a, 0x34, 0x10, 0xa0, 0xa1, 0xf4,
+    0x95, 0x0b, 0x68, 0xce, 0x46, 0x20, 0x9e, 0xd2, 0x33, 0x0d, 0xf7, 0x7f,
+    0x41, 0xfc, 0x72, 0xdd, 0x18, 0xa3, 0xc3, 0x98, 0x3f, 0x1f, 0x5a, 0xf5,
+    0x56, 0x4e, 0x0c, 0xca, 0xcb, 0x95, 0x3c, 0x27, 0x88, 0x88, 0xa1, 0x62,
+    0x73, 0x9a, 0x9c, 0x94, 0x9a, 0x34, 0x9a, 0xf3, 0x21, 0x45, 0x27, 0x05,
+    0x60, 0xc2, 0xe0, 0xe4, 0x6e, 0x48, 0xfe, 0xd2, 0x66, 0xea, 0xeb, 0x0c,
+    0xcc, 0x13, 0x39, 0xff, 0x87, 0xdd, 0x8c, 0x03, 0xd1, 0x0c, 0x47, 0x99,
+    0x02, 0x8a, 0xe0, 0x44, 0x47, 0x1c, 0x21, 0xa3, 0xb9, 0x01, 0xc3, 0x0a,
+    0x85, 0x54, 0x29, 0x12, 0x9a, 0x9d, 0x39, 0x5a, 0x2a, 0xba, 0xce, 0xd6,
+    0xb2, 0xab, 0x82, 0xab, 0x78, 0x35, 0x45, 0x45, 0xf6, 0xf4, 0x09, 0x86,
+    0xba, 0xfc, 0x0d, 0x57, 0xd4, 0x2d, 0x8b, 0x40, 0xf1, 0x04, 0x5a, 0x06,
+    0xa7, 0x85, 0x3f, 0x57, 0x00, 0x0e, 0x38, 0xc4, 0x79, 0x91, 0x96, 0xaf,
+    0x5e, 0xd5, 0x34, 0xa7, 0x7c, 0x3a, 0x86, 0xb3, 0x13, 0xa6, 0x13, 0xd4,
+    0x69, 0xf3, 0x7c, 0x23, 0x98, 0x03, 0x03, 0x03, 0x02, 0x82, 0xfb, 0x46,
+    0x63, 0x86, 0xa2, 0x46, 0xa2, 0x97, 0xb5, 0xc7, 0x1c, 0x62, 0x86, 0x47,
+    0xa9, 0x1d, 0xe8, 0xe2, 0x8f, 0x52, 0x55, 0x6d, 0x6c, 0x6f, 0x9c, 0x08,
+    0x65, 0xca, 0x28, 0x79, 0x10, 0x5d, 0xe8, 0xf1, 0x0d, 0x0f, 0x84, 0x87,
+    0xa8, 0xe9, 0x62, 0x68, 0xa9, 0xf3, 0x03, 0xf2, 0xaa, 0xc4, 0xa2, 0xbe,
+    0xf2, 0xa2, 0xce, 0x6a, 0x8e, 0x8d, 0x2a, 0x95, 0x79, 0x31, 0xb3, 0x05,
+    0x5f, 0x3b, 0x39, 0x31, 0xcc, 0x13, 0x08, 0x3e, 0xad, 0x28, 0x73, 0xaf,
+    0xe5, 0xf5, 0x71, 0x6d, 0x76, 0xf3, 0x0d, 0x77, 0x87, 0xa0, 0x31, 0xf1,
+    0x11, 0x11, 0x21, 0x03, 0x0b, 0x7c, 0xe8, 0x62, 0x66, 0xa0, 0x64, 0x66,
+    0xc6, 0xde, 0xe6, 0x77, 0xdf, 0x77, 0x7f, 0x9f, 0x9c, 0x9c, 0x87, 0xd7,
+    0xc8, 0x8e, 0x4f, 0x8a, 0x1c, 0x08, 0x0e, 0x28, 0x88, 0x91, 0x4b, 0xf3,
+    0xe2, 0x6b, 0x93, 0x3f, 0x4b, 0x77, 0x3e, 0x68, 0xdd, 0x3f, 0x2e, 0x0a,
+    0xcd, 0xbf, 0x7a, 0xa1, 0xb7, 0x96, 0xfe, 0x86, 0xf0, 0x88, 0xe4, 0xe4,
+    0xe4, 0x84, 0xd5, 0x15, 0x3e, 0xbd, 0xcb, 0xd0, 0xe5, 0x27, 0x97, 0x34,
+    0x39, 0x73, 0xdd, 0x37, 0x7e, 0x2c, 0xf3, 0x23, 0x8f, 0x23, 0xaf, 0x8a,
+    0x95, 0x50, 0x69, 0x0b, 0x56, 0x68, 0x2e, 0x4c, 0xf3, 0xcf, 0xbb, 0x4e,
+    0x10, 0xf0, 0x5c, 0xc2, 0xec, 0x83, 0x70, 0xc0, 0x3b, 0x02, 0xc6, 0x7c,
+    0xb3, 0xf8, 0x5e, 0x60, 0x68, 0xfd, 0x23, 0x0b, 0x03, 0x03, 0x03, 0x13,
+    0x7b, 0xcf, 0x4b, 0xce, 0x9c, 0x78, 0x91, 0xa7, 0xcb, 0x8a, 0x1c, 0xb1,
+    0x97, 0x2e, 0xc9, 0x7d, 0x79, 0xfe, 0xee, 0xef, 0xe6, 0xeb, 0x08, 0x18,
+    0x70, 0x59, 0xf3, 0xa3, 0xe3, 0x00, 0xf3, 0x40, 0xf9, 0x32, 0x5c, 0xca,
+    0x39, 0x32, 0xe6, 0x81, 0x9d, 0x5d, 0x42, 0xfa, 0x71, 0x66, 0x71, 0x14,
+    0x14, 0x12, 0x02, 0x02, 0xf7, 0x4b, 0xa6, 0xd6, 0x3d, 0x70, 0xed, 0x0d,
+    0xce, 0xf7, 0x2f, 0x0e, 0x0d, 0x67, 0xc7, 0x2e, 0xc4, 0x37, 0x1c, 0x7b,
+    0xc1, 0x1e, 0x2d, 0x07, 0xe1, 0x64, 0x4a, 0x37, 0x99, 0x34, 0x09, 0xc2,
+    0x0e, 0xa0, 0x29, 0x84, 0x6c, 0x40, 0xc8, 0x94, 0xef, 0x50, 0x27, 0x4d,
+    0x91, 0x91, 0x81, 0x01, 0x01, 0x01, 0x3c, 0xfa, 0xf7, 0x2f, 0x91, 0x4b,
+    0x14, 0x10, 0x52, 0xf7, 0x82, 0xf9, 0xfa, 0xc0, 0xa9, 0xd2, 0x8e, 0xd0,
+    0xe5, 0xd5, 0x1d, 0x55, 0xd0, 0x91, 0x21, 0x65, 0x0a, 0x08, 0x12, 0x60,
+    0xd1, 0x3f, 0x70, 0xf8, 0x19, 0x51, 0x25, 0x07, 0xc4, 0xca, 0x6b, 0xd4,
+    0x54, 0x6f, 0x98, 0x28, 0xf1, 0x0b, 0x06, 0x66, 0x23, 0xfe, 0xf1, 0xee,
+    0x86, 0x8f, 0x2c, 0x01, 0xf8, 0xf1, 0x10, 0x31, 0xfc, 0xf8, 0xa2, 0x4d,
+    0x9b, 0xc4, 0x0e, 0x45, 0xdd, 0x87, 0x19, 0x12, 0x90, 0xe6, 0x0f, 0x74,
+    0x65, 0x08, 0xfe, 0x1e, 0xee, 0xff, 0xd0, 0xe1, 0xc1, 0x1e, 0x70, 0x7a,
+    0x93, 0xe5, 0x4f, 0x54, 0xb6, 0xf3, 0x42, 0x85, 0x4c, 0x92, 0x84, 0xaa,
+    0xe2, 0x6c, 0x80, 0x5e, 0xe1, 0xa5, 0x88, 0xf3, 0xcf, 0x7b, 0xbf, 0x0e,
+    0xbf, 0xd2, 0x7c, 0xd1, 0xe5, 0x0f, 0x46, 0xaf, 0xbb, 0x75, 0x96, 0xbe,
+    0xa1, 0xc2, 0xa9, 0x4e, 0x36, 0x2e, 0x3f, 0xb8, 0x0e, 0xdf, 0xbc, 0x39,
+    0x88, 0xe6, 0x11, 0xd9, 0xb1, 0x0b, 0x38, 0x40, 0xc1, 0x43, 0x45, 0x72,
+    0xc2, 0x85, 0x3c, 0xbb, 0x3b, 0x3b, 0x38, 0x3f, 0xb1, 0x1c, 0x28, 0x11,
+    0x28, 0xa8, 0xb0, 0xe5, 0x09, 0x48, 0x13, 0xa7, 0x4e, 0x21, 0x31, 0x11,
+    0x78, 0x10, 0xa1, 0x84, 0x81, 0xb9, 0x7e, 0x20, 0x0a, 0x5e, 0x7c, 0x9d,
+    0xdd, 0x43, 0x8d, 0x1d, 0x49, 0xaf, 0x5f, 0xcc, 0x22, 0x07, 0xfb, 0x0b,
+    0x06, 0xfc, 0xfe, 0xc2, 0x63, 0xc4, 0xc1, 0x8d, 0x8b, 0x79, 0xf5, 0xef,
+    0x5c, 0xcf, 0x49, 0xc9, 0xf3, 0xef, 0x47, 0x4e, 0x12, 0x4f, 0xe3, 0xcb,
+    0xe3, 0xe9, 0x23, 0x06, 0x4c, 0xa6, 0xa5, 0xbb, 0xc7, 0x54, 0xa8, 0xa8,
+    0xd4, 0xc9, 0x4f, 0xdb, 0x86, 0xef, 0x0b, 0xf8, 0x72, 0x00, 0x81, 0x85,
+    0x9d, 0xa0, 0xa2, 0x82, 0xa0, 0xea, 0xc5, 0x7f, 0x96, 0x62, 0x52, 0x30,
+    0x34, 0x7f, 0x6d, 0x99, 0xea, 0xbb, 0xfc, 0xdd, 0xee, 0x5e, 0x47, 0x8a,
+    0x31, 0xb1, 0xa3, 0x0b, 0x0b, 0x3e, 0x7e, 0x39, 0x35, 0x2b, 0x6b, 0x91,
+    0x51, 0x7a, 0x45, 0x05, 0x57, 0x57, 0x39, 0x88, 0x69, 0x8a, 0x08, 0x18,
+    0x38, 0xbe, 0x70, 0x58, 0x54, 0xad, 0x3a, 0x55, 0xaa, 0xbb, 0x79, 0x61,
+    0x03, 0x34, 0xf7, 0xb6, 0x66, 0xcc, 0xb2, 0x33, 0x5c, 0xf8, 0xe4, 0xc5,
+    0x4e, 0x52, 0x65, 0xc6, 0x8e, 0xac, 0xd5, 0x29, 0xc6, 0xc8, 0xd9, 0x32,
+    0xc6, 0xf3, 0xc0, 0xd6, 0x74, 0xe8, 0xd3, 0xb9, 0x3e, 0xa0, 0x82, 0xbe,
+    0x14, 0x03, 0x8c, 0x5d, 0x03, 0xa7, 0xb4, 0x6f, 0x8d, 0xdf, 0x1c, 0x7c,
+    0xf8, 0x74, 0x00, 0x60, 0x60, 0x60, 0x6f, 0x67, 0x0b, 0x71, 0x9c, 0xf6,
+    0xf3, 0xe7, 0xd5, 0x8d, 0x6b, 0xaa, 0x3b, 0x81, 0x0f, 0x21, 0xdf, 0x0f,
+    0x35, 0x3d, 0xab, 0xb7, 0xb0, 0x66, 0x11, 0x14, 0x38, 0x68, 0x30, 0xe6,
+    0x04, 0x1f, 0x54, 0xb8, 0x53, 0x3b, 0x06, 0x1d, 0x5a, 0xb3, 0x8e, 0x14,
+    0x81, 0xf4, 0x88, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5e, 0x0d, 0x7d, 0xaa,
+    0xac, 0x34, 0x5c, 0x0c, 0x0c, 0xcd, 0x12, 0x04, 0x5d, 0xbc, 0xce, 0xdd,
+    0xc8, 0x7b, 0xac, 0x39, 0x04, 0x5b, 0xb8, 0x0f, 0x06, 0x79, 0x85, 0x3e,
+    0x60, 0x02, 0x02, 0x30, 0x3f, 0x03, 0x3f, 0x32, 0x7e, 0x22, 0xa3, 0x63,
+    0xc6, 0x2e, 0x56, 0x6b, 0xaf, 0x14, 0xa9, 0x68, 0xde, 0x98, 0x05, 0xc9,
+    0xcd, 0xfd, 0xe5, 0x27, 0x91, 0x35, 0x75, 0x5f, 0x66, 0x21, 0xbb, 0x31,
+    0x97, 0x35, 0x7c, 0x35, 0x1d, 0x72, 0xa5, 0x67, 0x4a, 0x3e, 0xae, 0x88,
+    0x44, 0xb0, 0x81, 0xc8, 0x38, 0x20, 0xfe, 0xcb, 0x82, 0x41, 0xf2, 0x34,
+    0xbc, 0xb8, 0x7e, 0x40, 0x14, 0xd1, 0xdd, 0x7a, 0x8c, 0x8e, 0x1f, 0xe1,
+    0x50, 0x50, 0x20, 0x20, 0x29, 0x8f, 0x3e, 0xda, 0x23, 0x58, 0xf8, 0xfc,
+    0x45, 0xf8, 0x11, 0x03, 0x97, 0xc1, 0xdb, 0xd6, 0x92, 0x85, 0x29, 0xd1,
+    0x14, 0x32, 0x4e, 0x38, 0x77, 0xc2, 0xe5, 0xf9, 0x71, 0xf0, 0xb4, 0x9c,
+    0x30, 0x82, 0x8a, 0xed, 0x1f, 0x99, 0x83, 0xa3, 0x4a, 0x24, 0xe4, 0x41,
+    0x71, 0x44, 0x6a, 0x56, 0xb9, 0x4d, 0xc9, 0xc9, 0xfc, 0x12, 0x12, 0x7b,
+    0xc4, 0x63, 0x72, 0x90, 0xc8, 0x89, 0xb8, 0x21, 0x17, 0x02, 0x1c, 0x50,
+    0xea, 0x45, 0x7a, 0xa4, 0x7d, 0x8b, 0x33, 0xf2, 0xe4, 0xa8, 0xb9, 0xc1,
+    0x3b, 0xd0, 0x9f, 0x30, 0xdc, 0x43, 0xee, 0x53, 0xf5, 0x23, 0x77, 0x31,
+    0x0e, 0x3d, 0xcc, 0xfa, 0xf1, 0x03, 0x05, 0xdd, 0xb9, 0xc3, 0x28, 0x29,
+    0xd3, 0x07, 0x74, 0x15, 0x23, 0x0f, 0x78, 0xef, 0x1f, 0xdf, 0x0b, 0xc7,
+    0xfd, 0x8f, 0x88, 0xec, 0x4e, 0xcd, 0xaa, 0xfa, 0xe2, 0x17, 0x03, 0x01,
+    0x24, 0x6f, 0x1e, 0x1e, 0x08, 0x39, 0x01, 0x20, 0x42, 0x90, 0x5f, 0x4b,
+    0x90, 0x10, 0x54, 0x48, 0x9e, 0x12, 0x12, 0x0e, 0x38, 0x78, 0xf0, 0x3c,
+    0xa0, 0x98, 0x3a, 0xa5, 0x64, 0x47, 0x47, 0x01, 0x99, 0x3f, 0x21, 0xee,
+    0xd3, 0x6c, 0x01, 0x9a, 0x2b, 0x55, 0xa8, 0x9d, 0x31, 0xe1, 0x47, 0x89,
+    0xe8, 0x3e, 0xa1, 0x2d, 0x1d, 0x2d, 0x1a, 0x20, 0x01, 0x17, 0x93, 0x84,
+    0x8e, 0x9d, 0xa0, 0x8c, 0xab, 0xaa, 0x85, 0xf8, 0x5e, 0xa0, 0xb9, 0x04,
+    0x4a, 0x50, 0x30, 0x41, 0x15, 0xcb, 0x89, 0x9e, 0xe0, 0xb8, 0x0c, 0x08,
+    0x3b, 0x89, 0x81, 0xfb, 0x3a, 0x2c, 0x02, 0x57, 0x3c, 0xe6, 0x0f, 0xf2,
+    0xaa, 0xd6, 0xcd, 0xb6, 0x6f, 0x9d, 0x88, 0xf0, 0x23, 0x8e, 0x31, 0xa3,
+    0xc8, 0x8f, 0x8b, 0x91, 0x4a, 0x93, 0x32, 0xc1, 0x03, 0x2b, 0x44, 0x53,
+    0x40, 0xd4, 0x55, 0xc1, 0xc6, 0xf5, 0x03, 0xca, 0x98, 0x4c, 0x1c, 0x15,
+    0x1a, 0x7a, 0x52, 0x77, 0x01, 0xb8, 0xf1, 0xec, 0x46, 0x0a, 0x17, 0x91,
+    0x12, 0x32, 0x24, 0x4e, 0xeb, 0x05, 0xc4, 0x2a, 0x85, 0xe0, 0x5e, 0x22,
+    0x53, 0x59, 0x4d, 0x67, 0x32, 0x7c, 0x5b, 0xf8, 0x78, 0x8d, 0xcb, 0xfa,
+    0xe6, 0x49, 0xf1, 0xa6, 0x86, 0x9d, 0x3c, 0x04, 0x24, 0xc5, 0x52, 0xe8,
+    0x95, 0x8a, 0xa7, 0xf2, 0xf6, 0xb5, 0xf3, 0x62, 0xc4, 0x68, 0x20, 0xbe,
+    0xce, 0xaf, 0x1c, 0xa4, 0x0a, 0xab, 0x6f, 0x10, 0xb1, 0xb4, 0x1c, 0x80,
+    0xf2, 0xc8, 0x90, 0x54, 0x50, 0x9c, 0xa0, 0xe0, 0x80, 0x74, 0x47, 0x9c,
+    0x07, 0xe8, 0x50, 0xe0, 0x60, 0x42, 0x22, 0x2e, 0x0e, 0x40, 0x96, 0x54,
+    0xa7, 0xa6, 0x6a, 0xe9, 0xfb, 0xb3, 0x54, 0xab, 0x19, 0x3a, 0x6e, 0xea,
+    0x06, 0x6c, 0x48, 0x25, 0xec, 0x5a, 0x37, 0x0b, 0x0c, 0xcc, 0xea, 0xef,
+    0x78, 0x71, 0xa5, 0x3f, 0x3e, 0x3c, 0x34, 0x1e, 0x88, 0x8f, 0x09, 0x6f,
+    0xd7, 0x05, 0xfa, 0x13, 0x1d, 0xd8, 0x70, 0xca, 0xe9, 0xf9, 0x71, 0xf0,
+    0x34, 0xef, 0x0d, 0xc7, 0x97, 0x2f, 0x4d, 0x05, 0x0f, 0x0a, 0x11, 0x95,
+    0x13, 0x26, 0x8f, 0x0b, 0xd4, 0x05, 0x16, 0x24, 0x04, 0x04, 0xf6, 0x9a,
+    0x69, 0xa7, 0x89, 0xcc, 0xeb, 0xfc, 0xaa, 0xc2, 0x40, 0xcd, 0x1c, 0x1f,
+    0x26, 0x2b, 0xe5, 0x48, 0x85, 0x20, 0xa1, 0xe2, 0x21, 0xec, 0x2c, 0x58,
+    0x9c, 0x62, 0xa2, 0xe3, 0x39, 0xe1, 0x74, 0xf6, 0xed, 0xdf, 0x07, 0xe5,
+    0xc7, 0x74, 0x5f, 0xf4, 0x9b, 0x93, 0x13, 0x47, 0x32, 0x71, 0x7d, 0xa8,
+    0xf4, 0xe4, 0xa6, 0xa2, 0xbe, 0xe8, 0x35, 0xda, 0xd7, 0x6f, 0x58, 0x8b,
+    0xc7, 0x4f, 0x9e, 0x73, 0x27, 0xc9, 0x8e, 0xc8, 0x72, 0xc4, 0x85, 0x68,
+    0xa3, 0x3a, 0x21, 0x51, 0xdc, 0x0f, 0x2f, 0xc0, 0x90, 0xe4, 0x09, 0x70,
+    0x4b, 0xc2, 0x9c, 0x10, 0x31, 0xb3, 0x0c, 0x24, 0x44, 0x64, 0x24, 0x81,
+    0x48, 0xc9, 0xc5, 0xd0, 0xa4, 0xe9, 0xd1, 0xa2, 0x00, 0xa9, 0x97, 0xb6,
+    0xda, 0xd5, 0x9a, 0x1a, 0x8a, 0x83, 0x44, 0x40, 0x83, 0x8f, 0xf9, 0x9c,
+    0xa0, 0xcb, 0x22, 0x43, 0x43, 0x4f, 0xd2, 0x82, 0x84, 0xc3, 0xa8, 0x1e,
+    0xa1, 0x30, 0xa8, 0xac, 0x54, 0x7f, 0xe8, 0xda, 0x79, 0xcc, 0x26, 0x3c,
+    0x9c, 0x5c, 0x5c, 0xe5, 0xed, 0x1d, 0xe5, 0x65, 0xed, 0xdb, 0xf8, 0x05,
+    0x13, 0x34, 0x34, 0xf7, 0x96, 0x52, 0x3c, 0x10, 0x83, 0xc2, 0x1f, 0x97,
+    0x24, 0x94, 0x14, 0x54, 0xdd, 0xe0, 0xe3, 0xc4, 0x60, 0xf7, 0xc7, 0xa7,
+    0x51, 0x83, 0xdc, 0xc7, 0x31, 0x28, 0xa1, 0x97, 0x8a, 0x9f, 0x91, 0xee,
+    0x4b, 0xf1, 0xea, 0xa9, 0x45, 0x7b, 0x97, 0x3f, 0xe9, 0x62, 0x86, 0x77,
+    0xcc, 0x44, 0x5c, 0x1f, 0x60, 0xd9, 0x9b, 0xc1, 0x00, 0x18, 0x18, 0x08,
+    0x0f, 0xb9, 0x3e, 0x74, 0x5e, 0xe7, 0x3b, 0x9e, 0x7d, 0x5b, 0xab, 0xab,
+    0xf8, 0xb9, 0x17, 0xcd, 0xbd, 0xd3, 0xe9, 0xe8, 0x94, 0xbe, 0x63, 0x05,
+    0xdf, 0x9f, 0x3c, 0xc9, 0xd9, 0x86, 0xd6, 0xcd, 0xa2, 0xc6, 0x1b, 0xa9,
+    0x4a, 0x1c, 0x6b, 0x19, 0x5f, 0x5e, 0x01, 0xd5, 0xd5, 0xd4, 0xe6, 0x26,
+    0x60, 0x6a, 0x16, 0x28, 0x6a, 0x55, 0x40, 0x84, 0xfd, 0x80
+};
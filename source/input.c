@@ -0,0 +1,78 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "SMSlib.h"
+
+#include "input.h"
+
+/* Must be a power of two */
+#define INPUT_QUEUE_SIZE 8
+
+/*
+ * Written by the frame interrupt, read by the game loop. Each side only
+ * moves its own index, so no locking is needed.
+ */
+static volatile uint16_t input_queue [INPUT_QUEUE_SIZE];
+static volatile uint8_t input_head = 0;
+static volatile uint8_t input_tail = 0;
+
+volatile uint16_t input_frames = 0;
+
+
+/*
+ * Frame interrupt handler: queue any keys that went down this frame, and
+ * count the frame. Runs even while the game loop is blocked in an
+ * animation, or the display is off, so no press or frame is lost. If the
+ * queue is full, the newest press is dropped.
+ */
+static void input_vblank (void)
+{
+    uint16_t pressed = SMS_getKeysPressed ();
+    uint8_t next = (input_head + 1) & (INPUT_QUEUE_SIZE - 1);
+
+    input_frames++;
+
+    if (pressed && next != input_tail)
+    {
+        input_queue [input_head] = pressed;
+        input_head = next;
+    }
+}
+
+
+/*
+ * Start sampling the keypad.
+ */
+void input_init (void)
+{
+    input_flush ();
+    SMS_setFrameInterruptHandler (input_vblank);
+}
+
+
+/*
+ * Take the oldest queued key-press event.
+ */
+uint16_t input_read (void)
+{
+    uint16_t pressed;
+
+    if (input_tail == input_head)
+    {
+        return 0;
+    }
+
+    pressed = input_queue [input_tail];
+    input_tail = (input_tail + 1) & (INPUT_QUEUE_SIZE - 1);
+
+    return pressed;
+}
+
+
+/*
+ * Discard any queued key-press events.
+ */
+void input_flush (void)
+{
+    input_tail = input_head;
+}
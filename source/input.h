@@ -0,0 +1,11 @@
+/* Frames since input_init (), counted by the frame interrupt. */
+extern volatile uint16_t input_frames;
+
+/* Sample the keypad from the frame interrupt into a small queue of key-press events. */
+void input_init (void);
+
+/* Take the oldest queued key-press event. Returns 0 if the queue is empty. */
+uint16_t input_read (void);
+
+/* Discard any queued key-press events. */
+void input_flush (void);
@@ -0,0 +1,83 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "layout.h"
+
+/*
+ * Screen layout, indexed by cursor stack:
+ *   0-7  : Tableau columns
+ *   8-10 : Dragon slots
+ *   11   : Dragon buttons
+ *   12-15: Snep foundation, foundations 1-3
+ */
+
+/* Card column (4 tiles wide) that each stack is drawn in */
+const uint8_t layout_column [16] = {
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3,
+    4, 5, 6, 7
+};
+
+/* Cursor X, in background pixels. Add the scroll to get a sprite X. */
+const uint8_t layout_sprite_x [16] = {
+     10,  42,  74, 110, 140, 169, 200, 232,
+     10,  42,  74, 110,
+    140, 169, 200, 232
+};
+
+/* Camera scroll that brings each stack into view */
+const uint8_t layout_scroll [16] = {
+     48,  38,  28,  18,   8, 238, 228, 208,
+     48,  38,  28,  18,
+      8, 238, 228, 208
+};
+
+/*
+ * Per-frame scroll step, indexed by the remaining distance to the target.
+ * Moves a quarter of the way each frame (at least one pixel), so the camera
+ * eases out as it arrives. The name table wraps, so the distance is taken
+ * modulo 256 and the camera always goes the short way round.
+ */
+static const int8_t scroll_ease [256] = {
+      0,   1,   1,   1,   1,   2,   2,   2,   2,   3,   3,   3,   3,   4,   4,   4,
+      4,   5,   5,   5,   5,   6,   6,   6,   6,   7,   7,   7,   7,   8,   8,   8,
+      8,   9,   9,   9,   9,  10,  10,  10,  10,  11,  11,  11,  11,  12,  12,  12,
+     12,  13,  13,  13,  13,  14,  14,  14,  14,  15,  15,  15,  15,  16,  16,  16,
+     16,  17,  17,  17,  17,  18,  18,  18,  18,  19,  19,  19,  19,  20,  20,  20,
+     20,  21,  21,  21,  21,  22,  22,  22,  22,  23,  23,  23,  23,  24,  24,  24,
+     24,  25,  25,  25,  25,  26,  26,  26,  26,  27,  27,  27,  27,  28,  28,  28,
+     28,  29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,
+    -32, -32, -32, -32, -31, -31, -31, -31, -30, -30, -30, -30, -29, -29, -29, -29,
+    -28, -28, -28, -28, -27, -27, -27, -27, -26, -26, -26, -26, -25, -25, -25, -25,
+    -24, -24, -24, -24, -23, -23, -23, -23, -22, -22, -22, -22, -21, -21, -21, -21,
+    -20, -20, -20, -20, -19, -19, -19, -19, -18, -18, -18, -18, -17, -17, -17, -17,
+    -16, -16, -16, -16, -15, -15, -15, -15, -14, -14, -14, -14, -13, -13, -13, -13,
+    -12, -12, -12, -12, -11, -11, -11, -11, -10, -10, -10, -10,  -9,  -9,  -9,  -9,
+     -8,  -8,  -8,  -8,  -7,  -7,  -7,  -7,  -6,  -6,  -6,  -6,  -5,  -5,  -5,  -5,
+     -4,  -4,  -4,  -4,  -3,  -3,  -3,  -3,  -2,  -2,  -2,  -2,  -1,  -1,  -1,  -1,
+};
+
+uint8_t scroll_x = 0;
+
+
+/*
+ * Move the camera one frame closer to the selected stack.
+ * Returns true if the camera moved.
+ */
+bool scroll_update (uint8_t stack)
+{
+    uint8_t step = scroll_ease [(uint8_t) (layout_scroll [stack] - scroll_x)];
+
+    scroll_x += step;
+
+    return step != 0;
+}
+
+
+/*
+ * Move the camera straight to the selected stack.
+ */
+void scroll_snap (uint8_t stack)
+{
+    scroll_x = layout_scroll [stack];
+}
@@ -0,0 +1,13 @@
+/* Card column, cursor X (background pixels) and camera scroll of each cursor stack. */
+extern const uint8_t layout_column [16];
+extern const uint8_t layout_sprite_x [16];
+extern const uint8_t layout_scroll [16];
+
+/* Current camera scroll, written to the VDP once per frame. */
+extern uint8_t scroll_x;
+
+/* Ease the camera one frame towards a stack. Returns true if it moved. */
+bool scroll_update (uint8_t stack);
+
+/* Move the camera straight to a stack. */
+void scroll_snap (uint8_t stack);
@@ -13,8 +13,23 @@
 
 #include "SMSlib.h"
 
+#include "debug.h"
+#include "demo.h"
+#include "hint.h"
+#include "input.h"
+#include "layout.h"
+#include "position.h"
 #include "rng.h"
+#include "sched.h"
+#include "solve.h"
+#include "stack.h"
+#include "tiles.h"
+#include "vdp.h"
+#include "patterns.h"
+#include "patterns_packed.c"
+#if defined (DEBUG_OVERLAY) && defined (BOOT_FULL)
 #include "patterns.c"
+#endif
 
 
 
@@ -23,6 +38,18 @@
 #define CARD_TYPE_MASK      0x30
 #define CARD_VALUE_MASK     0x0f
 #define STACK_HELD          15
+#define COLUMN_ROWS         17
+#define INDICATOR_TILE      282     /* After the game's own patterns */
+#define INDICATOR_COLOUR    11
+#define DEMO_IDLE_FRAMES    900     /* Menu frames without a press before the demo starts */
+#define DEMO_PRESS_FRAMES   8       /* Frames between the demo's key presses */
+#define DEMO_PRESSES        250     /* Most moves the demo tries before giving up on its game */
+#define SWEEP_CARDS         2       /* Most cards sliding home at once in the end-game sweep: 8 sprites on a line */
+#define SWEEP_FRAMES        10      /* Frames each card takes to slide home */
+#define SWEEP_STAGGER       3       /* Frames between the cards of a wave setting off */
+#define LOAD_BATCH_TILES    4       /* Tiles timed at a time when measuring pattern loads */
+#define BOOT_TILES          CORNER_NUMBERS  /* Tiles up to the card faces, loaded before the menu shows */
+#define STREAM_TILES        4       /* Card face tiles loaded each menu frame until they are all in */
 
 /* Palette */
 const uint8_t palette [16] = {
@@ -39,6 +66,21 @@ const uint8_t palette [16] = {
     0x04,   /* 10 - (menu) Dark green */
 };
 
+/* "Still winnable?" indicator: a dot drawn in its own colour, set by the search result */
+const uint32_t indicator_tiles [16] = {
+    0x00000300,     0x03000703,     0x07000f07,     0x07000f07,
+    0x07000f07,     0x07000f07,     0x03000703,     0x00000300,
+    0x0000c000,     0xc000e0c0,     0xe000f0e0,     0xe000f0e0,
+    0xe000f0e0,     0xe000f0e0,     0xc000e0c0,     0x0000c000,
+};
+
+/* Indicator colour for unknown, solvable and dead end */
+const uint16_t indicator_colours [3] = {
+    RGB (9, 9, 9),
+    RGB (4, 15, 4),
+    RGB (15, 3, 3)
+};
+
 //0e = red
 //3b=orange
 //3f=bright red
@@ -56,28 +98,34 @@ uint8_t cursor_style = 1;
  *         0-8: Numbers 1-9
  *         0-2: Claw, paw, hoof prints
  *         3  : Snep
- *  0xff: End of stack.
+ *  0xff: No card, as stack_card () gives above the top of a stack.
  */
 
-uint8_t deck [] = {
+const uint8_t deck_sorted [40] = {
     0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
     0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
     0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
     0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x32,
     0x32, 0x32, 0x32, 0x33
 };
+uint8_t deck [40];
 
 
-uint8_t stack [16] [16] = {
-    { 0xff }, { 0xff }, { 0xff }, { 0xff },
-    { 0xff }, { 0xff }, { 0xff }, { 0xff },
-    { 0xff }, { 0xff }, { 0xff }, { 0xff },
-    { 0xff }, { 0xff }, { 0xff }, { 0xff }
-};
 bool stack_changed [16] = { false };
 uint8_t came_from = 0xff;
+uint16_t legal_mask = 0;        /* Cursor stacks the held cards may be placed on, one bit each */
+bool cursor_snap = false;       /* While holding cards, left and right jump between legal places */
+bool board_moved = false;       /* A move was made since the game last checked for the end-game sweep */
 
 bool button_active [3] = { false };
+bool dragons_changed = false;
+bool buttons_changed = true;
+bool playing = false;
+bool demo_playing = false;
+uint8_t difficulty = DIFFICULTY_NORMAL;
+uint8_t indicator_shown = 0xff;
+uint16_t patterns_loaded = 0;   /* Tiles in VRAM from the start of the set, besides the background-only ones */
+const uint8_t *patterns_next;   /* Packed data of the next tile to stream in */
 
 /* Cursor */
 enum cursor_stack_e
@@ -105,29 +153,17 @@ enum cursor_stack_e
 uint8_t cursor_stack = CURSOR_COLUMN_1;
 uint8_t cursor_depth = CURSOR_DEPTH_MAX;
 
-unsigned char scrollX;
-void manageScroll();
 /*
  * Calculate the index of the top card in the selected stack.
  */
 uint8_t top_card (uint8_t s)
 {
-    uint8_t depth;
-
-    if (stack [s] [0] == 0xff)
+    if (stack_height [s] == 0)
     {
         return 0;
     }
 
-    for (depth = 0; depth < CURSOR_DEPTH_MAX; depth++)
-    {
-        if (stack [s] [depth + 1] == 0xff)
-        {
-            break;
-        }
-    }
-
-    return depth;
+    return stack_height [s] - 1;
 }
 
 
@@ -141,16 +177,16 @@ void check_dragons (void)
     uint8_t count [3] = { 0 };
 
     /* Check for empty slots */
-    if (stack [CURSOR_DRAGON_SLOT_1] [0] == 0xff ||
-        stack [CURSOR_DRAGON_SLOT_2] [0] == 0xff ||
-        stack [CURSOR_DRAGON_SLOT_3] [0] == 0xff)
+    if (stack_height [CURSOR_DRAGON_SLOT_1] == 0 ||
+        stack_height [CURSOR_DRAGON_SLOT_2] == 0 ||
+        stack_height [CURSOR_DRAGON_SLOT_3] == 0)
     {
         empty_slot = true;
     }
 
     for (uint8_t stack_idx = 0; stack_idx <= CURSOR_DRAGON_SLOT_3; stack_idx++)
     {
-        uint8_t card = stack [stack_idx] [top_card (stack_idx)];
+        uint8_t card = stack_top (stack_idx);
 
         for (uint8_t kind = 0; kind < 3; kind++)
         {
@@ -169,88 +205,111 @@ void check_dragons (void)
     /* Light up the button if all of a kind are visible and have somewhere to go */
     for (uint8_t kind = 0; kind < 3; kind++)
     {
-        button_active [kind] = (count [kind] == 4) && (empty_slot || in_slot [kind]);
+        bool active = (count [kind] == 4) && (empty_slot || in_slot [kind]);
+
+        if (button_active [kind] != active)
+        {
+            button_active [kind] = active;
+            buttons_changed = true;
+        }
     }
+
+    dragons_changed = false;
 }
 
 
 /*
- * Render a single card to an array of tile indexes.
+ * Tiles for each card, as rows of four: top, middle, middle, bottom, and the
+ * top again for when the card is stacked on another (showing the card below).
  */
-void render_card_tiles (uint16_t *buf, uint8_t card, bool stacked)
-{
-    uint8_t value = card & CARD_VALUE_MASK;
-    uint8_t tile;
+#define NUMBER_CARD(value, colour) { \
+    { CORNER_NUMBERS + (value) * 6 + (colour) * 2,      BLANK_CARD + 2, BLANK_CARD + 2, BLANK_CARD +  3 }, \
+    { BLANK_CARD + 5, ARTWORK_NUMBERS + (value) * 12 + (colour) * 4,     \
+                      ARTWORK_NUMBERS + (value) * 12 + (colour) * 4 + 1,                BLANK_CARD +  7 }, \
+    { BLANK_CARD + 5, ARTWORK_NUMBERS + (value) * 12 + (colour) * 4 + 2, \
+                      ARTWORK_NUMBERS + (value) * 12 + (colour) * 4 + 3,                BLANK_CARD +  7 }, \
+    { BLANK_CARD + 8,                                   BLANK_CARD + 9, BLANK_CARD + 9, BLANK_CARD + 10 }, \
+    { CORNER_NUMBERS + (value) * 6 + (colour) * 2 + 1,  BLANK_CARD + 2, BLANK_CARD + 2, BLANK_CARD +  4 }  \
+}
 
-    uint16_t card_tiles [] = {
-        BLANK_CARD +  0, BLANK_CARD +  2, BLANK_CARD +  2, BLANK_CARD +  3,
-//        BLANK_CARD +  5, BLANK_CARD +  6, BLANK_CARD +  6, BLANK_CARD +  7,
-        BLANK_CARD +  5, BLANK_CARD +  6, BLANK_CARD +  6, BLANK_CARD +  7,
-        BLANK_CARD +  5, BLANK_CARD +  6, BLANK_CARD +  6, BLANK_CARD +  7,
-//        BLANK_CARD +  5, BLANK_CARD +  6, BLANK_CARD +  6, BLANK_CARD +  7,
-        BLANK_CARD +  8, BLANK_CARD +  9, BLANK_CARD +  9, BLANK_CARD + 10
-    };
+#define PRINT_CARD(value) { \
+    { CORNER_PRINTS + (value) * 3,     CORNER_PRINTS + (value) * 3 + 2,  BLANK_CARD + 2,                   BLANK_CARD +  3 }, \
+    { BLANK_CARD + 5,                  ARTWORK_PRINTS + (value) * 4,     ARTWORK_PRINTS + (value) * 4 + 1, BLANK_CARD +  7 }, \
+    { BLANK_CARD + 5,                  ARTWORK_PRINTS + (value) * 4 + 2, ARTWORK_PRINTS + (value) * 4 + 3, BLANK_CARD +  7 }, \
+    { BLANK_CARD + 8,                  BLANK_CARD + 9,                   BLANK_CARD + 9,                   BLANK_CARD + 10 }, \
+    { CORNER_PRINTS + (value) * 3 + 1, CORNER_PRINTS + (value) * 3 + 2,  BLANK_CARD + 2,                   BLANK_CARD +  4 }  \
+}
 
-/*
-[1] 0,1,2,3
-[2] 4,5,6,7
-[3] 8,9,10,11
-[4] 12,13,14,15
-[5] 16,17,18,19
-[6] 20,21,22,23
-*/
+#define SNEP_CARD { \
+    { CORNER_SNEP,      BLANK_CARD +  2,  BLANK_CARD +  2,  BLANK_CARD +  3 }, \
+    { ARTWORK_SNEP + 0, ARTWORK_SNEP + 1, ARTWORK_SNEP +  2, ARTWORK_SNEP +  3 }, \
+    { ARTWORK_SNEP + 4, ARTWORK_SNEP + 5, ARTWORK_SNEP +  6, ARTWORK_SNEP +  7 }, \
+    { ARTWORK_SNEP + 8, ARTWORK_SNEP + 9, ARTWORK_SNEP + 10, ARTWORK_SNEP + 11 }, \
+    { CORNER_SNEP + 1,  BLANK_CARD +  2,  BLANK_CARD +  2,  BLANK_CARD +  4 }  \
+}
 
-    if ((card & CARD_TYPE_MASK) == 0x30)
-    {
-        if (value == 3)
-        {
-            /* Snep card */
-            card_tiles [0]  = CORNER_SNEP;
-            card_tiles [15] = CORNER_SNEP + 2;// card_tiles [23] = CORNER_SNEP + 2;
+#define CARD_ROW_STACKED    4
+#define CARD_INDEX(card)    (((card) >> 4) * 9 + ((card) & CARD_VALUE_MASK))
+
+const uint16_t card_rows [31] [5] [4] = {
+    NUMBER_CARD (0, 0), NUMBER_CARD (1, 0), NUMBER_CARD (2, 0), NUMBER_CARD (3, 0), NUMBER_CARD (4, 0),
+    NUMBER_CARD (5, 0), NUMBER_CARD (6, 0), NUMBER_CARD (7, 0), NUMBER_CARD (8, 0),
+    NUMBER_CARD (0, 1), NUMBER_CARD (1, 1), NUMBER_CARD (2, 1), NUMBER_CARD (3, 1), NUMBER_CARD (4, 1),
+    NUMBER_CARD (5, 1), NUMBER_CARD (6, 1), NUMBER_CARD (7, 1), NUMBER_CARD (8, 1),
+    NUMBER_CARD (0, 2), NUMBER_CARD (1, 2), NUMBER_CARD (2, 2), NUMBER_CARD (3, 2), NUMBER_CARD (4, 2),
+    NUMBER_CARD (5, 2), NUMBER_CARD (6, 2), NUMBER_CARD (7, 2), NUMBER_CARD (8, 2),
+    PRINT_CARD (0), PRINT_CARD (1), PRINT_CARD (2), SNEP_CARD
+};
 
-            for (uint8_t i = 0; i < 12; i++)//16
-            {
-                card_tiles [i + 4] = ARTWORK_SNEP + i;//4
-            }
-        }
-        else
-        {
-            /* Print card */
-            card_tiles [0]  = CORNER_PRINTS + (value * 3);
-            card_tiles [1]  = CORNER_PRINTS + (value * 3) + 2;
-
-            tile = ARTWORK_PRINTS + value * 4;
-            card_tiles [5] = tile;//9
-            card_tiles [6] = tile + 1;//10
-            card_tiles [9] = tile + 2;//13
-            card_tiles [10] = tile + 3;//14
-        }
-    }
-    else
-    {
-        /* Standard card */
-        uint8_t colour = card >> 4;
+#define OUTLINE(n)  PATTERN_ENTRY (OUTLINE_CARD + (n))
+
+const uint16_t empty_slot [4] [4] = {
+    { OUTLINE (0), OUTLINE (1), OUTLINE (1), OUTLINE (2) },
+    { OUTLINE (3), EMPTY_TILE,  EMPTY_TILE,  OUTLINE (4) },
+    { OUTLINE (3), EMPTY_TILE,  EMPTY_TILE,  OUTLINE (4) },
+    { OUTLINE (5), OUTLINE (6), OUTLINE (6), OUTLINE (7) }
+};
 
-        /* Card corners */
-        tile = CORNER_NUMBERS + value * 6 + colour * 2;
-        card_tiles [ 0] = tile;
+/* Dragon buttons, off and on, each 2x2 */
+#define BUTTON(kind, active)    { PATTERN_ENTRY (BUTTON_TILES + (kind) * 8 + (active) * 4 + 0), \
+                                  PATTERN_ENTRY (BUTTON_TILES + (kind) * 8 + (active) * 4 + 1), \
+                                  PATTERN_ENTRY (BUTTON_TILES + (kind) * 8 + (active) * 4 + 2), \
+                                  PATTERN_ENTRY (BUTTON_TILES + (kind) * 8 + (active) * 4 + 3) }
 
-        /* Chinese numbers */
-        tile = ARTWORK_NUMBERS + value * 12 + colour * 4;
-        card_tiles [5] = tile;//9
-        card_tiles [6] = tile + 1;//10
-        card_tiles [9] = tile + 2;//13
-        card_tiles [10] = tile + 3;//14
-    }
+const uint16_t button_tiles [3] [2] [4] = {
+    { BUTTON (0, 0), BUTTON (0, 1) },
+    { BUTTON (1, 0), BUTTON (1, 1) },
+    { BUTTON (2, 0), BUTTON (2, 1) }
+};
+
+/* Menu card text and icons, 4x1 and 2x2 */
+#define MENU_ENTRIES(first, i)  { PATTERN_ENTRY ((first) + (i) * 4 + 0), PATTERN_ENTRY ((first) + (i) * 4 + 1), \
+                                  PATTERN_ENTRY ((first) + (i) * 4 + 2), PATTERN_ENTRY ((first) + (i) * 4 + 3) }
+
+const uint16_t menu_text [3] [4] = {
+    MENU_ENTRIES (MENU_TEXT, 0), MENU_ENTRIES (MENU_TEXT, 1), MENU_ENTRIES (MENU_TEXT, 2)
+};
 
-    if (stacked)
+const uint16_t menu_icons [3] [4] = {
+    MENU_ENTRIES (MENU_ICONS, 0), MENU_ENTRIES (MENU_ICONS, 1), MENU_ENTRIES (MENU_ICONS, 2)
+};
+
+const uint16_t blank_row [4] = {
+    EMPTY_TILE, EMPTY_TILE, EMPTY_TILE, EMPTY_TILE
+};
+
+
+/*
+ * Look up one row of tiles for a card.
+ */
+const uint16_t *card_row (uint8_t card, uint8_t row, bool stacked)
+{
+    if (row == 0 && stacked)
     {
-        /* Show top of card below */
-        card_tiles [0] += 1;
-        card_tiles [3] += 1;
+        row = CARD_ROW_STACKED;
     }
 
-    memcpy (buf, card_tiles, sizeof (card_tiles));
+    return card_rows [CARD_INDEX (card)] [row];
 }
 
 
@@ -272,7 +331,7 @@ void cursor_render_xy (uint8_t cursor_x, uint8_t cursor_y, bool cursor_visible)
     }
 
     /* Render held cards as sprites */
-    if (stack [STACK_HELD] [0] != 0xff)
+    if (stack_height [STACK_HELD] != 0)
     {
         uint8_t card_x = cursor_x - 16;
         uint8_t top = top_card (STACK_HELD);
@@ -280,13 +339,11 @@ void cursor_render_xy (uint8_t cursor_x, uint8_t cursor_y, bool cursor_visible)
         for (uint8_t i = top; i != 0xff; i--)
         {
             uint16_t card_y = cursor_y + (8 * i) - 4;
-            uint16_t card_tiles [16];//24
-
-            render_card_tiles (card_tiles, stack [STACK_HELD] [i], i > 0);
 
             for (uint8_t y = 0; y < 4; y++)//6
             {
                 uint16_t sprite_y = card_y + (8 * y);
+                const uint16_t *tiles = card_row (stack_card (STACK_HELD, i), y, i > 0);
 
 #define screen_max_Y 144
 
@@ -299,7 +356,7 @@ void cursor_render_xy (uint8_t cursor_x, uint8_t cursor_y, bool cursor_visible)
                 for (uint8_t x = 0; x < 4; x++)
                 {
 //SMS_addSprite (unsigned char x, unsigned char y, unsigned char tile);  /* declare a sprite - returns handle or -1 if no more sprites are available */
-                    SMS_addSprite (card_x + (8 * x), sprite_y, (uint8_t) card_tiles [x + (4 * y)]);
+                    SMS_addSprite (card_x + (8 * x), sprite_y, (uint8_t) tiles [x]);
                 }
 
                 /* Only the top card is fully drawn */
@@ -320,18 +377,15 @@ void cursor_render_xy (uint8_t cursor_x, uint8_t cursor_y, bool cursor_visible)
  */
 void cursor_sd_to_xy (uint8_t stack, uint8_t depth, uint8_t *x, uint8_t *y)
 {
-   // *x = (stack & 0x07) * 32 + 16;
-
-if(cursor_stack==CURSOR_COLUMN_1  || cursor_stack==CURSOR_DRAGON_SLOT_1)*x = 58;
-else if(cursor_stack==CURSOR_COLUMN_2 || cursor_stack==CURSOR_DRAGON_SLOT_2)*x = 80;
-else if(cursor_stack==CURSOR_COLUMN_3 || cursor_stack==CURSOR_DRAGON_SLOT_3)*x = 102;
-else if(cursor_stack==CURSOR_COLUMN_4 || cursor_stack==CURSOR_DRAGON_BUTTONS)*x = 128;
-else if(cursor_stack==CURSOR_COLUMN_5 || cursor_stack==CURSOR_FOUNDATION_SNEP)*x = 148;
-else if(cursor_stack==CURSOR_COLUMN_6 || cursor_stack==CURSOR_FOUNDATION_1)*x = 151;
-else if(cursor_stack==CURSOR_COLUMN_7 || cursor_stack==CURSOR_FOUNDATION_2)*x = 172;
-else if(cursor_stack==CURSOR_COLUMN_8 || cursor_stack==CURSOR_FOUNDATION_3)*x = 184;
-
-if(in_menu==true)*x = (stack & 0x07) * 32 + 16;
+    if (in_menu)
+    {
+        *x = (stack & 0x07) * 32 + 16;
+    }
+    else
+    {
+        /* Sprites don't scroll, so follow the camera */
+        *x = layout_sprite_x [stack] + scroll_x;
+    }
 
     if (stack == CURSOR_DRAGON_BUTTONS)
     {
@@ -360,7 +414,7 @@ void cursor_render (void)
     cursor_sd_to_xy (cursor_stack, cursor_depth, &cursor_x, &cursor_y);
 
     /* Offset the cursor if we're holding a card */
-    if (stack [STACK_HELD] [0] != 0xff)
+    if (stack_height [STACK_HELD] != 0)
     {
         cursor_x += 2;
         cursor_y += 12;
@@ -368,6 +422,45 @@ void cursor_render (void)
 
 
     cursor_render_xy (cursor_x, cursor_y, true);
+
+    /* Mark the other places the held cards may go */
+    if (stack_height [STACK_HELD] != 0 && !in_menu)
+    {
+        /* Lines of the held cards already carry four card and two cursor
+         * sprites, so only two markers may share them */
+        uint16_t held_top = cursor_y - 4;
+        uint16_t held_bottom = cursor_y + (8 * top_card (STACK_HELD)) + 28;
+        uint8_t held_markers = 0;
+
+        for (uint8_t c = 0; c < CURSOR_STACK_MAX; c++)
+        {
+            uint8_t stack_idx = (c < CURSOR_DRAGON_BUTTONS) ? c : c - 1;
+
+            if (c == cursor_stack || c == came_from || !(legal_mask & ((uint16_t) 1 << c)))
+            {
+                continue;
+            }
+
+            cursor_sd_to_xy (c, (stack_height [stack_idx] == 0) ? 0 : top_card (stack_idx) + 1, &cursor_x, &cursor_y);
+
+            /* Only those on screen */
+            if ((uint8_t) (cursor_x - 40) >= 168)
+            {
+                continue;
+            }
+
+            if (cursor_y + 8 > held_top && cursor_y < held_bottom)
+            {
+                if (held_markers == 2)
+                {
+                    continue;
+                }
+                held_markers++;
+            }
+
+            SMS_addSprite (cursor_x, cursor_y, (uint8_t) (CURSOR_BLACK + (4 * cursor_style)));
+        }
+    }
 }
 
 
@@ -386,9 +479,14 @@ void cursor_move (uint8_t direction)
             cursor_stack = (cursor_stack + (CURSOR_STACK_MAX - 1)) % CURSOR_STACK_MAX;
             cursor_depth = CURSOR_DEPTH_MAX;
 
+            while (cursor_snap && stack_height [STACK_HELD] != 0 && !(legal_mask & ((uint16_t) 1 << cursor_stack)))
+            {
+                cursor_stack = (cursor_stack + (CURSOR_STACK_MAX - 1)) % CURSOR_STACK_MAX;
+            }
+
             if (cursor_stack == CURSOR_DRAGON_BUTTONS)
             {
-                if (stack [STACK_HELD] [0] != 0xff)
+                if (stack_height [STACK_HELD] != 0)
                 {
                     /* Skip over the buttons if holding a card */
                     cursor_stack--;
@@ -406,10 +504,15 @@ void cursor_move (uint8_t direction)
             cursor_stack = (cursor_stack + 1) % CURSOR_STACK_MAX;
             cursor_depth = CURSOR_DEPTH_MAX;
 
+            while (cursor_snap && stack_height [STACK_HELD] != 0 && !(legal_mask & ((uint16_t) 1 << cursor_stack)))
+            {
+                cursor_stack = (cursor_stack + 1) % CURSOR_STACK_MAX;
+            }
+
             /* Skip over the buttons if holding a card */
             if (cursor_stack == CURSOR_DRAGON_BUTTONS)
             {
-                if (stack [STACK_HELD] [0] != 0xff)
+                if (stack_height [STACK_HELD] != 0)
                 {
                     /* Skip over the buttons if holding a card */
                     cursor_stack++;
@@ -425,7 +528,7 @@ void cursor_move (uint8_t direction)
         case PORT_A_KEY_UP:
             if (cursor_depth > 0 &&
                     ((cursor_stack == CURSOR_DRAGON_BUTTONS) ||
-                     (cursor_stack <= CURSOR_COLUMN_8 && stack [STACK_HELD] [0] == 0xff)))
+                     (cursor_stack <= CURSOR_COLUMN_8 && stack_height [STACK_HELD] == 0)))
             {
                 cursor_depth--;
             }
@@ -442,7 +545,7 @@ void cursor_move (uint8_t direction)
     {
         stack_max_depth = 2;
     }
-    else if (stack [stack_idx] [0] != 0xff)
+    else if (stack_height [stack_idx] != 0)
     {
         stack_max_depth = top_card (stack_idx);
     }
@@ -463,6 +566,65 @@ if (in_menu==true)
 }
 
 
+/*
+ * Work out every stack the held cards may be placed on, as a bit for each
+ * cursor stack. The stack they came from is always allowed.
+ */
+uint16_t legal_targets (void)
+{
+    uint8_t held = stack_card (STACK_HELD, 0);
+    bool single = (stack_height [STACK_HELD] == 1);
+    bool special = ((held & CARD_TYPE_MASK) == 0x30);
+    uint16_t mask = (uint16_t) 1 << came_from;
+
+    for (uint8_t c = 0; c < CURSOR_STACK_MAX; c++)
+    {
+        uint8_t stack_idx = (c < CURSOR_DRAGON_BUTTONS) ? c : c - 1;
+        uint8_t bottom = stack_card (stack_idx, 0);
+        uint8_t top = stack_top (stack_idx);
+        bool legal;
+
+        if (c <= CURSOR_COLUMN_8)
+        {
+            /* Special cards cannot be stacked, colours must alternate, and value must decrease */
+            legal = (top == 0xff) ||
+                    (!special && (top & CARD_TYPE_MASK) != 0x30 && (top & CARD_TYPE_MASK) != (held & CARD_TYPE_MASK) &&
+                     (top & CARD_VALUE_MASK) == (held & CARD_VALUE_MASK) + 1);
+        }
+        else if (c <= CURSOR_DRAGON_SLOT_3)
+        {
+            /* Only single cards may be placed in the dragon slots */
+            legal = (bottom == 0xff) && single;
+        }
+        else if (c == CURSOR_DRAGON_BUTTONS)
+        {
+            /* Not a card slot */
+            legal = false;
+        }
+        else if (c == CURSOR_FOUNDATION_SNEP)
+        {
+            /* Only the snep card may be placed in the snep card slot */
+            legal = (held == 0x33);
+        }
+        else
+        {
+            /* One card at a time, no special cards, starting from a '1' and going up in the same colour */
+            legal = !special && single &&
+                    ((bottom == 0xff) ? (held & CARD_VALUE_MASK) == 0 :
+                     (top & CARD_TYPE_MASK) == (held & CARD_TYPE_MASK) &&
+                     (top & CARD_VALUE_MASK) == (held & CARD_VALUE_MASK) - 1);
+        }
+
+        if (legal)
+        {
+            mask |= (uint16_t) 1 << c;
+        }
+    }
+
+    return mask;
+}
+
+
 /*
  * Pick up the selected card.
  */
@@ -472,12 +634,19 @@ void cursor_pick (void)
     uint8_t stack_idx = (cursor_stack < CURSOR_DRAGON_BUTTONS) ? cursor_stack : cursor_stack - 1;
 
     /* Check if the selected cards can be picked up together */
-    if (stack [stack_idx] [cursor_depth + 1] != 0xff)
+    if (stack_height [stack_idx] > cursor_depth + 1)
     {
         uint8_t previous_card = 0;
-        for (i = 0; stack [stack_idx] [cursor_depth + i] != 0xff; i++)
+        uint8_t entry = stack_base [stack_idx];
+
+        for (i = 0; i < cursor_depth; i++)
+        {
+            entry = card_next [entry];
+        }
+
+        for (i = 0; entry != STACK_END; i++, entry = card_next [entry])
         {
-            uint8_t card = stack [stack_idx] [cursor_depth + i];
+            uint8_t card = card_value [entry];
 
             /* Special cards cannot be stacked */
             if ((card & CARD_TYPE_MASK) == 0x30)
@@ -517,15 +686,11 @@ void cursor_pick (void)
     }
 
     /* Move the selected stack into the hand */
-    for (i = 0; stack [stack_idx] [cursor_depth + i] != 0xff; i++)
-    {
-        stack [STACK_HELD] [i] = stack [stack_idx] [cursor_depth + i];
-        stack [stack_idx] [cursor_depth + i] = 0xff;
-    }
-    stack [STACK_HELD] [i] = 0xff;
+    stack_move (stack_idx, cursor_depth, STACK_HELD);
     stack_changed [stack_idx] = true;
 
     came_from = cursor_stack;
+    legal_mask = legal_targets ();
 
     /* Point at the new top card in the stack */
     cursor_depth = CURSOR_DEPTH_MAX;
@@ -538,111 +703,27 @@ void cursor_pick (void)
  */
 void cursor_place (void)
 {
-    uint8_t i;
+    uint8_t count = stack_height [STACK_HELD];
     uint8_t stack_idx = (cursor_stack < CURSOR_DRAGON_BUTTONS) ? cursor_stack : cursor_stack - 1;
 
-    /* Check if cards are allowed to move here */
-    if (cursor_stack != came_from)
-    {
-        uint8_t stack_card = stack [stack_idx] [cursor_depth];
-
-        if (cursor_stack <= CURSOR_COLUMN_8)
-        {
-            if (stack_card != 0xff)
-            {
-                /* Special cards cannot be stacked */
-                if (((stack_card             & 0x30) == 0x30) ||
-                    ((stack [STACK_HELD] [0] & 0x30) == 0x30))
-                {
-                    return;
-                }
-
-                /* Colours must alternate */
-                if ((stack_card & 0x30) == (stack [STACK_HELD] [0] & 0x30))
-                {
-                    return;
-                }
-
-                /* Value must decrease */
-                if ((stack_card & CARD_VALUE_MASK) != (stack [STACK_HELD] [0] & CARD_VALUE_MASK) + 1)
-                {
-                    return;
-                }
-            }
-        }
-        else if (cursor_stack <= CURSOR_DRAGON_SLOT_3)
-        {
-            /* Only single cards may be placed in the dragon slots */
-            if ((stack_card != 0xff) || (stack [STACK_HELD] [1] != 0xff))
-            {
-                return;
-            }
-        }
-        else if (cursor_stack <= CURSOR_DRAGON_BUTTONS)
-        {
-            /* Not a card slot */
-            return;
-        }
-        else if (cursor_stack <= CURSOR_FOUNDATION_SNEP)
-        {
-            /* Only the snep card may be placed in the snep card slot */
-            if (stack [STACK_HELD] [0] != 0x33)
-            {
-                return;
-            }
-        }
-        else if (cursor_stack <= CURSOR_FOUNDATION_3)
-        {
-            /* No special cards, and only one card at a time */
-            if ((stack [STACK_HELD] [0] & CARD_TYPE_MASK) == 0x30 || stack [STACK_HELD] [1] != 0xff)
-            {
-                return;
-            }
-
-            /* Only a '1' can be placed on an empty slot */
-            if (stack [stack_idx] [0] == 0xff)
-            {
-                if ((stack [STACK_HELD] [0] & CARD_VALUE_MASK) != 0)
-                {
-                    return;
-                }
-            }
-            else
-            {
-                /* Cards in a foundation must all be the same colour */
-                if ((stack_card & CARD_TYPE_MASK) != (stack [STACK_HELD] [0] & CARD_TYPE_MASK))
-                {
-                    return;
-                }
-                /* Cards in a foundation must be in increasing order */
-                if ((stack_card & CARD_VALUE_MASK) != (stack [STACK_HELD] [0] & CARD_VALUE_MASK) - 1)
-                {
-                    return;
-                }
-            }
-        }
-        else
-        {
-            /* Invalid */
-            return;
-        }
-
-    }
-
-    /* Place at the first empty slot, not the last full slot */
-    if (stack [stack_idx] [0] != 0xff)
+    /* Check if cards are allowed to move here, as worked out when they were picked up */
+    if (!(legal_mask & ((uint16_t) 1 << cursor_stack)))
     {
-        cursor_depth++;
+        return;
     }
 
     /* Move the cards from the hand */
-    for (i = 0; stack [STACK_HELD] [i] != 0xff; i++)
+    stack_move (STACK_HELD, 0, stack_idx);
+    stack_changed [stack_idx] = true;
+
+    /* A move, rather than putting the cards back */
+    if (cursor_stack != came_from)
     {
-        stack [stack_idx] [cursor_depth + i] = stack [STACK_HELD] [i];
-        stack [STACK_HELD] [i] = 0xff;
+        position_remember ();
+        hint_played ((came_from < CURSOR_DRAGON_BUTTONS) ? came_from : came_from - 1, stack_idx, count);
+        solve_restart ();
+        board_moved = true;
     }
-    stack [stack_idx] [cursor_depth + i] = 0xff;
-    stack_changed [stack_idx] = true;
 
     came_from = 0xff;
 
@@ -652,118 +733,97 @@ void cursor_place (void)
 }
 
 
-/*
- * Render one card to the background.
- */
-void render_card_background (uint8_t col, uint8_t y, uint8_t card, bool stacked, bool covered)
-{
-    uint16_t card_tiles [16];//24
-
-    render_card_tiles (card_tiles, card, stacked);
-
-    SMS_loadTileMapArea ((4 * col), y+1, &card_tiles, 4, covered ? 1 : 4);//last parameter 6->4    y+1
-//the cards in the playing field
-}
-
 /*
  * Renders the cards.
  */
 void render_background (void)
 {
-    uint16_t blank_line [] = {
-        EMPTY_TILE, EMPTY_TILE, EMPTY_TILE, EMPTY_TILE
-    };
-    uint16_t empty_slot [] = {
-        OUTLINE_CARD + 0, OUTLINE_CARD + 1, OUTLINE_CARD + 1, OUTLINE_CARD + 2,
-        //OUTLINE_CARD + 3, EMPTY_TILE,       EMPTY_TILE,       OUTLINE_CARD + 4,
-        OUTLINE_CARD + 3, EMPTY_TILE,       EMPTY_TILE,       OUTLINE_CARD + 4,
-        OUTLINE_CARD + 3, EMPTY_TILE,       EMPTY_TILE,       OUTLINE_CARD + 4,
-        //OUTLINE_CARD + 3, EMPTY_TILE,       EMPTY_TILE,       OUTLINE_CARD + 4,
-        OUTLINE_CARD + 5, OUTLINE_CARD + 6, OUTLINE_CARD + 6, OUTLINE_CARD + 7
-    };
-    uint16_t button_tiles [4];
-
     /* Dragons & Foundations*/
     for (uint8_t i = 0; i < 7; i++)
     {
-        uint8_t col = (i < 3) ? i : i + 1;
+        uint8_t col = layout_column [(i < 3) ? 8 + i : 9 + i];
 
         if (!stack_changed [8 + i])
         {
             continue;
         }
 
-        if (stack [i + 8] [0] != 0xff)//these are cards dropped into the top row
+        if (stack_height [i + 8] != 0)//these are cards dropped into the top row
         {
-            uint8_t depth = top_card (i + 8);
-            render_card_background (col, 3, stack [i + 8] [depth], false, false);//2nd param 2
+            vdp_card_strip ((4 * col), 4, card_rows [CARD_INDEX (stack_top (i + 8))] [0], 4);
         }
         else
         {
-            SMS_loadTileMapArea ((4 * col), 4, &empty_slot, 4, 4);//last parameter 6->4, 2nd parameter 3
+            vdp_card_strip ((4 * col), 4, empty_slot [0], 4);//last parameter 6->4, 2nd parameter 3
         }
     }
 
-    /* Tableau columns */
+    /* Tableau columns, from row 10 down to the bottom of the name table */
     for (int col = 0; col < 8; col++)
     {
-        uint8_t depth;
+        const uint16_t *rows [COLUMN_ROWS];
+        uint8_t row = 0;
 
         if (!stack_changed [col])
         {
             continue;
         }
 
-        if (stack [col] [0] == 0xff)
+        if (stack_height [col] == 0)
         {
-            SMS_loadTileMapArea ((4 * col), 10, &empty_slot, 4, 4);//last parameter 6->4, 2nd param 9->8, 8 works well
-            depth = 1;
+            for (; row < 4; row++)
+            {
+                rows [row] = empty_slot [row];
+            }
         }
         else
         {
-            for (depth = 0; depth < 13; depth++)
+            uint8_t depth = 0;
+
+            /* Covered cards show only their top row */
+            for (uint8_t entry = stack_base [col]; entry != STACK_END && depth < 13; entry = card_next [entry])
             {
-                uint8_t card = stack [col] [depth];
-                uint8_t next = stack [col] [depth + 1];
+                uint8_t card = card_value [entry];
 
-                if (card == 0xff)
+                rows [row++] = card_row (card, 0, depth);
+
+                if (card_next [entry] == STACK_END)
                 {
-                    break;
+                    for (uint8_t y = 1; y < 4; y++)
+                    {
+                        rows [row++] = card_row (card, y, depth);
+                    }
                 }
 
-                render_card_background (col, 9 + depth, card, depth, next != 0xff);//9
-//cards in the field
+                depth++;
             }
         }
 
         /* Clear area below stack */
-        depth += 4;//5
-        while (depth < 18)//18
-        {//loadTileMapArea (unsigned char x, unsigned char y,  unsigned int *src, unsigned char width, unsigned char height);
-            SMS_loadTileMapArea ((4 * col), 9 + depth, &blank_line, 4, 1);//9+depth
-            depth++;
+        while (row < COLUMN_ROWS)
+        {
+            rows [row++] = blank_row;
         }
+
+        vdp_column ((4 * col), 10, rows, COLUMN_ROWS);
     }
 
+    /* The buttons are re-checked later, outside of VBlank */
     for (uint8_t i = 0; i < sizeof (stack_changed); i++)
     {
         if (stack_changed [i])
         {
-            check_dragons ();
+            dragons_changed = true;
             break;
         }
     }
 
     /* Buttons */
-    for (uint8_t i = 0; i < 3; i++)
+    for (uint8_t i = 0; buttons_changed && i < 3; i++)
     {
-        button_tiles [0] = BUTTON_TILES + (i * 8) + (button_active [i] * 4);
-        button_tiles [1] = BUTTON_TILES + (i * 8) + (button_active [i] * 4) + 1;
-        button_tiles [2] = BUTTON_TILES + (i * 8) + (button_active [i] * 4) + 2;
-        button_tiles [3] = BUTTON_TILES + (i * 8) + (button_active [i] * 4) + 3;
-
-        SMS_loadTileMapArea (13, (i * 2) + 3, &button_tiles, 2, 2);//(i * 2) + 1
+        SMS_loadTileMapArea (13, (i * 2) + 3, button_tiles [i] [button_active [i]], 2, 2);//(i * 2) + 1
     }
+    buttons_changed = false;
 
     memset (stack_changed, false, sizeof (stack_changed));
 }
@@ -799,19 +859,120 @@ void card_slide (uint16_t start_x, uint16_t start_y,
 }
 
 
+#ifdef DEBUG_OVERLAY
+/*
+ * Unpack tiles into VRAM a batch at a time, adding the scanlines each batch
+ * took to the overlay's packed load time. A batch takes well under a frame,
+ * so the V counter can time it.
+ */
+const uint8_t *load_timed (const uint8_t *src, uint16_t tile, uint16_t count)
+{
+    while (count > 0)
+    {
+        uint16_t batch = (count < LOAD_BATCH_TILES) ? count : LOAD_BATCH_TILES;
+        uint8_t start = SMS_getVCount ();
+
+        src = tiles_unpack (src, tile, batch);
+        debug_value [1] += (uint8_t) (SMS_getVCount () - start);
+        tile += batch;
+        count -= batch;
+    }
+
+    return src;
+}
+#else
+#define load_timed tiles_unpack
+#endif
+
+
+/*
+ * Load the tile patterns the menu needs into VRAM: the background-only
+ * tiles at the end of the set, then the empty tile, cursors and blank card
+ * at its start. The card faces in between stream in behind the menu.
+ * BOOT_FULL builds load every tile here, to compare.
+ *
+ * Debug builds time the packed loads. BOOT_FULL ones load the raw tiles
+ * first too, timed the same way, for the overlay to compare.
+ */
+void load_patterns (void)
+{
+#ifdef BOOT_FULL
+#ifdef DEBUG_OVERLAY
+    /* The raw set has the flipped tiles too, so it goes first, for the packed set to replace */
+    for (uint16_t tile = 0; tile < sizeof (patterns) / 32; tile += LOAD_BATCH_TILES)
+    {
+        uint16_t count = (sizeof (patterns) / 32 - tile < LOAD_BATCH_TILES) ? sizeof (patterns) / 32 - tile : LOAD_BATCH_TILES;
+        uint8_t start = SMS_getVCount ();
+
+        SMS_loadTiles (&patterns [tile * 8], tile, count * 32);
+        debug_value [0] += (uint8_t) (SMS_getVCount () - start);
+    }
+
+    /* Boot frames are counted from here, so the raw load does not count against the packed one */
+    input_frames = 0;
+#endif
+
+    patterns_next = load_timed (patterns_packed, 0, PATTERN_TILES);
+    patterns_loaded = PATTERN_BACKGROUND_TILE;
+#else
+    load_timed (patterns_packed + PATTERN_BACKGROUND_OFFSET, PATTERN_BACKGROUND_TILE,
+                PATTERN_TILES - PATTERN_BACKGROUND_TILE);
+    patterns_next = load_timed (patterns_packed, 0, BOOT_TILES);
+    patterns_loaded = BOOT_TILES;
+#endif
+}
+
+
+/*
+ * Load up to (count) more of the card face tiles.
+ */
+void load_patterns_more (uint16_t count)
+{
+    if (patterns_loaded == PATTERN_BACKGROUND_TILE)
+    {
+        return;
+    }
+
+    if (count > PATTERN_BACKGROUND_TILE - patterns_loaded)
+    {
+        count = PATTERN_BACKGROUND_TILE - patterns_loaded;
+    }
+    patterns_next = tiles_unpack (patterns_next, patterns_loaded, count);
+    patterns_loaded += count;
+
+#ifdef DEBUG_OVERLAY
+    if (patterns_loaded == PATTERN_BACKGROUND_TILE)
+    {
+        debug_value [3] = input_frames;
+    }
+#endif
+}
+
+
 /*
  * Deal a new game.
  */
 void deal (void)
 {
+    uint16_t deal_seed;
+    uint16_t next_seed;
     uint8_t i;
 
+    /* The cards need every tile, and the menu may not have waited for them all */
+    load_patterns_more (PATTERN_BACKGROUND_TILE);
+
     rng_seed ();
 
-    for (i = 0; i < 16; i++)
-    {
-        stack [i] [0] = 0xff;
-    }
+    /*
+     * Shuffle the sorted deck with the seed of a deal of the chosen
+     * difficulty, or any seed, then carry on with the random sequence.
+     */
+    deal_seed = hint_pick (difficulty);
+    next_seed = rand ();
+    srand (deal_seed);
+    memcpy (deck, deck_sorted, sizeof (deck));
+
+    stack_clear ();
     memset (stack_changed, true, sizeof (stack_changed));
     render_background ();
 
@@ -824,10 +985,10 @@ void deal (void)
         deck [i] = deck [swap_i];
         deck [swap_i] = temp;
     }
+    srand (next_seed);
 
     /* Place the cards */
     i = 0;
-    stack [STACK_HELD] [1] = 0xff;
     for (uint8_t depth = 0; depth < 5; depth++)
     {
         for (uint8_t col = 0; col < 8; col++)
@@ -837,22 +998,22 @@ void deal (void)
 
             cursor_sd_to_xy (col, depth, &dest_x, &dest_y);
 
-dest_x=(col+1)*32;
-
             /* Animate the card being dealt */
-            stack [STACK_HELD] [0] = deck [i];
+            stack_push (STACK_HELD, deck [i++]);
             card_slide (dest_x, 144+24, dest_x, dest_y, 8, false);//2nd paramter is where it comes from
-            stack [STACK_HELD] [0] = 0xff;
 
             /* Store the card in its new position */
-            stack [col] [depth] = deck [i++];
-            stack [col] [depth + 1] = 0xff;
+            stack_move (STACK_HELD, 0, col);
             stack_changed [col] = true;
 
             render_background ();
         }
     }
 
+    position_reset ();
+    hint_start (deal_seed);
+    solve_restart ();
+
     cursor_stack = CURSOR_COLUMN_6;//CURSOR_COLUMN_1;
     cursor_depth = CURSOR_DEPTH_MAX;
     cursor_move (PORT_A_KEY_DOWN);
@@ -865,7 +1026,6 @@ dest_x=(col+1)*32;
 void undeal (void)
 {
     bool cards_left = true;
-    stack [STACK_HELD] [1] = 0xff;
 
     while (cards_left)
     {
@@ -885,7 +1045,7 @@ void undeal (void)
 
             top = top_card (stack_idx);
 
-            if (stack [stack_idx] [top] == 0xff)
+            if (stack_height [stack_idx] == 0)
             {
                 continue;
             }
@@ -896,14 +1056,13 @@ void undeal (void)
             cursor_sd_to_xy (col, top, &from_x, &from_y);
 
             /* Animate the card being removed */
-            stack [STACK_HELD] [0] = stack [stack_idx] [top];
-            stack [stack_idx] [top] = 0xff;
+            stack_move (stack_idx, top, STACK_HELD);
             stack_changed [stack_idx] = true;
 
             render_background ();
             card_slide (from_x, from_y, from_x, 144+24, 8, false);//192
 
-            stack [STACK_HELD] [0] = 0xff;
+            stack_discard (STACK_HELD);
         }
     }
 }
@@ -913,19 +1072,13 @@ void undeal (void)
  */
 void clear_background (void)
 {
-    uint16_t blank_line [32] = { 0 };//32
-
 //256/8=32
 //160/8=20
 
 //224/8=28
 //144/8=18
 
-    for (uint8_t row = 0; row < 18; row++)//24
-    {
-//SMS_loadTileMapArea (unsigned char x, unsigned char y,  unsigned int *src, unsigned char width, unsigned char height);
-        SMS_loadTileMapArea (0, row, &blank_line, 28, 1);//32
-    }
+    vdp_blank_strip (0, 0, 28, 18);//32, 24
 }
 
 
@@ -946,7 +1099,7 @@ void stack_dragons (void)
     /* First, see if we already have a slot */
     for (uint8_t stack_idx = CURSOR_DRAGON_SLOT_1; stack_idx <= CURSOR_DRAGON_SLOT_3; stack_idx++)
     {
-        if (stack [stack_idx] [0] == card_match)
+        if (stack_card (stack_idx, 0) == card_match)
         {
             dest_idx = stack_idx;
             break;
@@ -958,7 +1111,7 @@ void stack_dragons (void)
     {
         for (uint8_t stack_idx = CURSOR_DRAGON_SLOT_1; stack_idx <= CURSOR_DRAGON_SLOT_3; stack_idx++)
         {
-            if (stack [stack_idx] [0] == 0xff)
+            if (stack_height [stack_idx] == 0)
             {
                 dest_idx = stack_idx;
                 break;
@@ -968,45 +1121,38 @@ void stack_dragons (void)
 
     /* Animation end-point */
     cursor_sd_to_xy (dest_idx, 0, &to_x, &to_y);
-    stack [STACK_HELD] [0] = card_match;
-    stack [STACK_HELD] [1] = 0xff;
 
-    /* Remove the dragons from wherever they may be */
+    /* Move the dragons from wherever they may be, leaving any already in the slot */
     for (uint8_t stack_idx = 0; stack_idx <= CURSOR_DRAGON_SLOT_3; stack_idx++)
     {
         uint8_t top = top_card (stack_idx);
 
-        if (stack [stack_idx] [top] == card_match)
+        if (stack_idx != dest_idx && stack_top (stack_idx) == card_match)
         {
             /* Animation start-point */
             cursor_sd_to_xy (stack_idx, top, &from_x, &from_y);
 
-            stack [stack_idx] [top] = 0xff;
+            stack_move (stack_idx, top, STACK_HELD);
             stack_changed [stack_idx] = true;
             render_background ();
 
             card_slide (from_x, from_y, to_x, to_y, 10, false);
+            stack_move (STACK_HELD, 0, dest_idx);
 
-            /* If there are currently no cards in the destination, draw one after the first slide-animation */
-            if (stack [dest_idx] [0] == 0xff)
+            /* Only the slot's first card changes how it looks */
+            if (stack_height [dest_idx] == 1)
             {
-                stack [dest_idx] [0] = card_match;
-                stack [dest_idx] [1] = 0xff;
                 stack_changed [dest_idx] = true;
                 render_background ();
             }
         }
     }
 
-    stack [STACK_HELD] [0] = 0xff;
-
-    /* Place all four dragons into the destination slot */
-    for (uint8_t i = 0; i < 4; i++)
-    {
-        stack [dest_idx] [i] = card_match;
-    }
-    stack [dest_idx] [4] = 0xff;
-}
+    position_remember ();
+    hint_played (HINT_DRAGONS, dest_idx, dragon_idx);
+    solve_restart ();
+    board_moved = true;
+}
 
 
 /*
@@ -1039,7 +1185,7 @@ void move_auto (void)
     cursor_pick ();
 
     /* Abort if there wasn't actually a card */
-    if (stack [STACK_HELD] [0] == 0xff)
+    if (stack_height [STACK_HELD] == 0)
     {
         return;
     }
@@ -1053,7 +1199,7 @@ void move_auto (void)
         cursor_place ();
 
         /* Placement was successful */
-        if (stack [STACK_HELD] [0] == 0xff)
+        if (stack_height [STACK_HELD] == 0)
         {
             /* Animation end-point */
             cursor_sd_to_xy (cursor_stack, cursor_depth, &to_x, &to_y);
@@ -1071,13 +1217,241 @@ void move_auto (void)
     cursor_stack = from_stack;
     cursor_depth = CURSOR_DEPTH_MAX;
     cursor_move (PORT_A_KEY_DOWN);
-    if (stack [STACK_HELD] [0] != 0xff)
+    if (stack_height [STACK_HELD] != 0)
     {
         cursor_place ();
     }
 }
 
 
+/*
+ * The foundation that takes a card, given each foundation's colour and
+ * height, or 0xff. Foundations with a bit set in (claimed) are passed over.
+ */
+uint8_t sweep_target (uint8_t card, const uint8_t *colour, const uint8_t *height, uint8_t claimed)
+{
+    if (card == 0x33)
+    {
+        return (claimed & 0x01) ? 0xff : 0;
+    }
+
+    if ((card & CARD_TYPE_MASK) == 0x30)
+    {
+        return 0xff;
+    }
+
+    /* The foundation already holding the colour, or else the first empty one for a '1' */
+    for (uint8_t f = 1; f < 4; f++)
+    {
+        if (height [f] > 0 && colour [f] == (card & CARD_TYPE_MASK))
+        {
+            return (height [f] == (card & CARD_VALUE_MASK) && !(claimed & (1 << f))) ? f : 0xff;
+        }
+    }
+    for (uint8_t f = 1; f < 4; f++)
+    {
+        if (height [f] == 0 && (card & CARD_VALUE_MASK) == 0 && !(claimed & (1 << f)))
+        {
+            return f;
+        }
+    }
+
+    return 0xff;
+}
+
+
+/*
+ * Read the foundations (snep first) into colour and height arrays for sweep_target ().
+ */
+void sweep_foundations (uint8_t *colour, uint8_t *height)
+{
+    for (uint8_t f = 0; f < 4; f++)
+    {
+        uint8_t stack_idx = CURSOR_FOUNDATION_SNEP - 1 + f;
+
+        colour [f] = stack_card (stack_idx, 0) & CARD_TYPE_MASK;
+        height [f] = stack_height [stack_idx];
+    }
+}
+
+
+/*
+ * Check if the game can be finished by sending cards home alone: every
+ * dragon is stacked, and playing out the cards that can go home, in any
+ * order, leaves nothing on the table.
+ */
+bool collectable (void)
+{
+    uint8_t height [CURSOR_DRAGON_SLOT_3 + 1];
+    uint8_t f_colour [4];
+    uint8_t f_height [4];
+    bool progress = true;
+
+    sweep_foundations (f_colour, f_height);
+
+    for (uint8_t s = 0; s <= CURSOR_DRAGON_SLOT_3; s++)
+    {
+        height [s] = stack_height [s];
+
+        /* Stacked dragons are done with */
+        if (s >= CURSOR_DRAGON_SLOT_1 && height [s] > 1)
+        {
+            height [s] = 0;
+        }
+    }
+
+    while (progress)
+    {
+        progress = false;
+
+        for (uint8_t s = 0; s <= CURSOR_DRAGON_SLOT_3; s++)
+        {
+            uint8_t card;
+            uint8_t f;
+
+            if (height [s] == 0)
+            {
+                continue;
+            }
+
+            card = stack_card (s, height [s] - 1);
+            f = sweep_target (card, f_colour, f_height, 0);
+            if (f != 0xff)
+            {
+                f_colour [f] = card & CARD_TYPE_MASK;
+                f_height [f]++;
+                height [s]--;
+                progress = true;
+            }
+        }
+    }
+
+    for (uint8_t s = 0; s <= CURSOR_DRAGON_SLOT_3; s++)
+    {
+        if (height [s] != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ * End-game sweep: send every card home without waiting for presses.
+ *
+ * Cards go in waves of up to SWEEP_CARDS, one from each stack and to each
+ * foundation. A wave's cards leave their stacks together, with one
+ * background update that also draws the last wave landing, and then slide
+ * home as sprites at the same time, each setting off a little after the
+ * one before. Until they land they are held, so the foundations they are
+ * going to are still drawn as they were.
+ */
+void collect (void)
+{
+    uint8_t f_colour [4];
+    uint8_t f_height [4];
+    uint8_t count = 1;
+
+    while (count > 0)
+    {
+        uint8_t card [SWEEP_CARDS];
+        uint8_t from [SWEEP_CARDS];
+        uint8_t to [SWEEP_CARDS];
+        uint8_t from_x [SWEEP_CARDS];
+        uint8_t from_y [SWEEP_CARDS];
+        uint8_t to_x [SWEEP_CARDS];
+        uint8_t to_y [SWEEP_CARDS];
+        uint8_t claimed = 0;
+
+        sweep_foundations (f_colour, f_height);
+
+        /* Take this wave's cards off the table */
+        count = 0;
+        for (uint8_t s = 0; s <= CURSOR_DRAGON_SLOT_3 && count < SWEEP_CARDS; s++)
+        {
+            uint8_t top = top_card (s);
+            uint8_t f;
+
+            if (stack_height [s] == 0 || (s >= CURSOR_DRAGON_SLOT_1 && top > 0))
+            {
+                continue;
+            }
+
+            f = sweep_target (stack_top (s), f_colour, f_height, claimed);
+            if (f == 0xff)
+            {
+                continue;
+            }
+
+            claimed |= 1 << f;
+            card [count] = stack_top (s);
+            from [count] = s;
+            to [count] = CURSOR_FOUNDATION_SNEP + f;
+            cursor_sd_to_xy (s, top, &from_x [count], &from_y [count]);
+            cursor_sd_to_xy (to [count], f_height [f], &to_x [count], &to_y [count]);
+
+            stack_move (s, top, STACK_HELD);
+            stack_changed [s] = true;
+            count++;
+        }
+
+        render_background ();
+
+        /* Slide them home together */
+        for (uint8_t frame = 1; count > 0 && frame < SWEEP_FRAMES + SWEEP_STAGGER * (count - 1); frame++)
+        {
+            SMS_initSprites ();
+
+            for (uint8_t i = 0; i < count; i++)
+            {
+                uint8_t t = (frame > SWEEP_STAGGER * i) ? frame - SWEEP_STAGGER * i : 0;
+                uint16_t x;
+                uint16_t y;
+
+                if (t >= SWEEP_FRAMES)
+                {
+                    t = SWEEP_FRAMES;
+                }
+
+                x = (((uint16_t) from_x [i] * (SWEEP_FRAMES - t)) + ((uint16_t) to_x [i] * t)) / SWEEP_FRAMES;
+                y = (((uint16_t) from_y [i] * (SWEEP_FRAMES - t)) + ((uint16_t) to_y [i] * t)) / SWEEP_FRAMES;
+
+                for (uint8_t row = 0; row < 4; row++)
+                {
+                    const uint16_t *tiles = card_row (card [i], row, false);
+
+                    for (uint8_t col = 0; col < 4; col++)
+                    {
+                        SMS_addSprite (x - 16 + (8 * col), y - 4 + (8 * row), (uint8_t) tiles [col]);
+                    }
+                }
+            }
+
+            SMS_waitForVBlank ();
+            SMS_copySpritestoSAT ();
+        }
+
+        /* Land them, to be drawn with the next wave, the last held first */
+        for (uint8_t i = count; i-- > 0;)
+        {
+            stack_move (STACK_HELD, stack_height [STACK_HELD] - 1, to [i] - 1);
+            stack_changed [to [i] - 1] = true;
+        }
+        for (uint8_t i = 0; i < count; i++)
+        {
+            hint_played (from [i], to [i] - 1, 1);
+        }
+    }
+
+    SMS_initSprites ();
+    SMS_copySpritestoSAT ();
+    position_remember ();
+    solve_restart ();
+}
+
+
 /*
  * Cancel the current card movement, returning to where it came from.
  */
@@ -1107,89 +1481,431 @@ void move_cancel (void)
 
 
 /*
- * Play one game.
+ * Point the cursor at the next move of the deal's winning line: the cards
+ * to pick up, or where to put the cards held if they are the right ones.
  */
-void game (void)
+void move_hint (void)
 {
-    bool playing = true;
+    uint8_t held = stack_height [STACK_HELD];
 
-    while (playing)
+    if (hint_from == HINT_NONE)
     {
-        static uint16_t keys_previous = 0;
-        uint16_t keys = SMS_getKeysStatus ();
-        uint16_t keys_pressed = (keys & ~keys_previous);
+        return;
+    }
 
-        /* Logic */
-        if (keys_pressed & PORT_A_KEY_DPAD)
+    if (held == 0)
+    {
+        if (hint_from == HINT_DRAGONS)
         {
-            cursor_move (keys_pressed);
+            cursor_stack = CURSOR_DRAGON_BUTTONS;
+            cursor_depth = hint_count;
+        }
+        else
+        {
+            cursor_stack = hint_from;
+            cursor_depth = top_card (hint_from) + 1 - hint_count;
         }
+    }
+    else if (came_from == hint_from && held == hint_count)
+    {
+        cursor_stack = hint_to;
+        cursor_depth = CURSOR_DEPTH_MAX;
 
-        if (keys_pressed & PORT_A_KEY_1)
+        if (hint_to == HINT_HOME)
         {
-            if (stack [STACK_HELD] [0] == 0xff)
+            /* The foundation already holding the colour, or else the first empty one */
+            cursor_stack = CURSOR_FOUNDATION_SNEP;
+            if (stack_card (STACK_HELD, 0) != 0x33)
             {
-                if (cursor_stack == CURSOR_DRAGON_BUTTONS)
+                for (uint8_t i = CURSOR_FOUNDATION_3; i >= CURSOR_FOUNDATION_1; i--)
                 {
-                    if (button_active [cursor_depth])
+                    uint8_t bottom = stack_card (i - 1, 0);
+
+                    if (bottom == 0xff || (bottom & CARD_TYPE_MASK) == (stack_card (STACK_HELD, 0) & CARD_TYPE_MASK))
                     {
-                        stack_dragons ();
+                        cursor_stack = i;
+                        if (bottom != 0xff)
+                        {
+                            break;
+                        }
                     }
                 }
-                else
-                {
-                    cursor_pick ();
-                }
-            }
-            else
-            {
-                cursor_place ();
             }
         }
-        else if (keys_pressed & PORT_A_KEY_2)
+    }
+    else
+    {
+        return;
+    }
+
+    cursor_move (0);
+}
+
+
+/*
+ * Act on one key-press event during play.
+ */
+void game_input (uint16_t keys_pressed)
+{
+    if (keys_pressed & PORT_A_KEY_DPAD)
+    {
+        cursor_move (keys_pressed);
+    }
+
+    if (keys_pressed & PORT_A_KEY_1)
+    {
+        if (stack_height [STACK_HELD] == 0)
         {
             if (cursor_stack == CURSOR_DRAGON_BUTTONS)
             {
-                /* Do nothing */
+                /* Don't trust a button state from before this frame's moves */
+                if (dragons_changed)
+                {
+                    check_dragons ();
+                }
+
+                if (button_active [cursor_depth])
+                {
+                    stack_dragons ();
+                }
             }
-            else if (stack [STACK_HELD] [0] == 0xff)
+            else
             {
-                move_auto ();
+                cursor_pick ();
             }
-            else
+        }
+        else
+        {
+            cursor_place ();
+        }
+    }
+    else if (keys_pressed & PORT_A_KEY_2)
+    {
+        if (cursor_stack == CURSOR_DRAGON_BUTTONS)
+        {
+            /* Do nothing */
+        }
+        else if (stack_height [STACK_HELD] == 0)
+        {
+            move_auto ();
+        }
+        else
+        {
+            move_cancel ();
+        }
+    }
+
+    if (keys_pressed & GG_KEY_START)
+    {
+        move_hint ();
+    }
+}
+
+
+/*
+ * Frame task: Copy the sprites to the SAT if they have changed.
+ */
+void update_sprites (void)
+{
+    if (sprite_update)
+    {
+        SMS_copySpritestoSAT ();
+        sprite_update = false;
+    }
+}
+
+
+/*
+ * Frame task: Write the camera position.
+ */
+void update_scroll (void)
+{
+    SMS_setBGScrollX (scroll_x);
+}
+
+
+/*
+ * Frame task: Re-check the dragon buttons after the board has changed.
+ */
+void update_dragons (void)
+{
+    if (dragons_changed)
+    {
+        check_dragons ();
+    }
+}
+
+
+/*
+ * Frame task: Check if the game is still in progress.
+ */
+void update_playing (void)
+{
+    playing = false;
+    for (uint8_t i = 0; i <= CURSOR_COLUMN_8; i++)
+    {
+        if (stack_height [i] != 0)
+        {
+            playing = true;
+        }
+    }
+    if (stack_height [STACK_HELD] != 0)
+    {
+        playing = true;
+    }
+}
+
+
+/*
+ * Frame task: Show the search result in the indicator's colour.
+ */
+void update_indicator (void)
+{
+    const uint16_t indicator_map [2] = { INDICATOR_TILE, INDICATOR_TILE + 1 };
+
+    if (solve_result != indicator_shown)
+    {
+        if (indicator_shown == 0xff)
+        {
+            /* Below the dragon buttons */
+            SMS_loadTileMapArea (13, 9, indicator_map, 2, 1);
+        }
+        GG_setBGPaletteColor (INDICATOR_COLOUR, indicator_colours [solve_result]);
+        indicator_shown = solve_result;
+    }
+}
+
+
+#ifdef DEBUG_OVERLAY
+/*
+ * Frame task: Show the frame timing counters, and the search's slice,
+ * scanlines used, result and positions searched. In the demo, show the
+ * evaluator's slice and scanlines used instead, and the frames and
+ * scanlines its last move took to choose.
+ */
+void update_debug (void)
+{
+    debug_value [0] = sched_overruns;
+    debug_value [1] = sched_vblank_lines;
+    if (demo_playing)
+    {
+        debug_value [2] = (DEMO_SLICE << 8) | demo_lines;
+        debug_value [3] = ((uint16_t) demo_frames << 12) | ((demo_cost > 0x0fff) ? 0x0fff : demo_cost);
+    }
+    else
+    {
+        debug_value [2] = (SOLVE_SLICE << 8) | solve_lines;
+        debug_value [3] = ((uint16_t) solve_result << 12) | ((solve_nodes > 0x0fff) ? 0x0fff : solve_nodes);
+    }
+    debug_render (scroll_x);
+}
+#endif
+
+
+/*
+ * Work done once per frame during play. Budgets are in scanlines.
+ * VBlank lasts 70 lines, and everything that writes to the VDP must fit in it.
+ */
+const task_t vblank_tasks [] = {
+    { update_sprites,    28 },
+    { update_scroll,      1 },
+    { render_background, 36 },
+    { update_indicator,   1 },
+#ifdef DEBUG_OVERLAY
+    { update_debug,       4 },
+#endif
+};
+
+const task_t active_tasks [] = {
+    { update_dragons,     8 },
+    { update_playing,     2 },
+    { solve_run,          SOLVE_SLICE + 32 },
+};
+
+/* In the demo, the move evaluator takes the search's place */
+const task_t demo_tasks [] = {
+    { update_dragons,     8 },
+    { update_playing,     2 },
+    { demo_run,           DEMO_SLICE + 16 },
+};
+
+
+/*
+ * Play one game.
+ */
+void game (void)
+{
+    uint16_t keys_pressed;
+
+    /* Presses made during the deal animation are stale */
+    input_flush ();
+
+    playing = true;
+    while (playing)
+    {
+        /* Logic, for every press since the last frame */
+        while ((keys_pressed = input_read ()))
+        {
+            game_input (keys_pressed);
+        }
+
+        /* Once the rest is a formality, finish it off */
+        if (board_moved && stack_height [STACK_HELD] == 0)
+        {
+            board_moved = false;
+            if (collectable ())
             {
-                move_cancel ();
+                collect ();
+                input_flush ();
             }
         }
 
-        keys_previous = keys;
+        /* Ease the camera towards the cursor, taking the sprites with it */
+        if (scroll_update (cursor_stack))
+        {
+            cursor_render ();
+        }
 
-        /* Update H/W during vblank */
+        /* Update H/W during vblank, then the slower checks */
         SMS_waitForVBlank ();
+        sched_run_vblank (vblank_tasks, sizeof (vblank_tasks) / sizeof (task_t));
+        sched_run_active (active_tasks, sizeof (active_tasks) / sizeof (task_t));
+    }
+}
 
-        if (sprite_update)
+
+/*
+ * The next key the demo presses to make its chosen move, going through the
+ * same cursor path as a player would. Returns 0 while it is still choosing.
+ */
+uint16_t demo_key (void)
+{
+    uint8_t target_stack;
+    uint8_t target_depth = cursor_depth;
+    uint16_t action = PORT_A_KEY_1;
+
+    if (stack_height [STACK_HELD] == 0)
+    {
+        if (!demo_ready)
         {
-            SMS_copySpritestoSAT ();
-            sprite_update = false;
+            return 0;
         }
-        render_background ();
-manageScroll();
 
+        if (demo_from == DEMO_DRAGONS)
+        {
+            target_stack = CURSOR_DRAGON_BUTTONS;
+            target_depth = demo_count;
+        }
+        else
+        {
+            /* Cards going home take the auto move */
+            target_stack = demo_from;
+            target_depth = top_card (demo_from) + 1 - demo_count;
+            if (demo_to == DEMO_HOME)
+            {
+                action = PORT_A_KEY_2;
+            }
+        }
+    }
+    else
+    {
+        target_stack = demo_to;
+    }
+
+    if (cursor_stack != target_stack)
+    {
+        return (((target_stack - cursor_stack) & 0x0f) <= 8) ? PORT_A_KEY_RIGHT : PORT_A_KEY_LEFT;
+    }
+    if (cursor_depth > target_depth)
+    {
+        return PORT_A_KEY_UP;
+    }
+    if (cursor_depth < target_depth)
+    {
+        return PORT_A_KEY_DOWN;
+    }
+
+    return action;
+}
+
+
+/*
+ * Attract mode: deal an easy game and let the demo bot play it until a key is
+ * pressed, the game is won, or the bot runs out of moves.
+ */
+void demo (void)
+{
+    uint8_t wait = 0;
+    uint8_t presses = 0;
+
+    uint8_t chosen = difficulty;
+
+    in_menu = false;
+    demo_playing = true;
+
+    /* The bot has no look-ahead, so it plays the deals it stands a chance with */
+    difficulty = DIFFICULTY_EASY;
+    deal ();
+    difficulty = chosen;
+    demo_restart ();
+
+    input_flush ();
 
-        /* Check if the game is still in progress */
-        playing = false;
-        for (uint8_t i = 0; i <= CURSOR_COLUMN_8; i++)
+    playing = true;
+    while (playing && presses < DEMO_PRESSES && input_read () == 0)
+    {
+        if (++wait == DEMO_PRESS_FRAMES)
         {
-            if (stack [i] [0] != 0xff)
+            uint16_t key = demo_key ();
+
+            wait = 0;
+
+            if (stack_height [STACK_HELD] == 0 && demo_ready && demo_from == DEMO_NONE)
             {
-                playing = true;
+                break;
+            }
+
+            if (key != 0)
+            {
+                game_input (key);
+
+                /* The move is over once nothing is held */
+                if ((key & (PORT_A_KEY_1 | PORT_A_KEY_2)) && stack_height [STACK_HELD] == 0)
+                {
+                    demo_restart ();
+                }
+                if (key & (PORT_A_KEY_1 | PORT_A_KEY_2))
+                {
+                    presses++;
+                }
             }
         }
-        if (stack [STACK_HELD] [0] != 0xff)
+
+        if (scroll_update (cursor_stack))
         {
-            playing = true;
+            cursor_render ();
         }
+
+        SMS_waitForVBlank ();
+        sched_run_vblank (vblank_tasks, sizeof (vblank_tasks) / sizeof (task_t));
+        sched_run_active (demo_tasks, sizeof (demo_tasks) / sizeof (task_t));
+    }
+
+    if (!playing)
+    {
+        undeal ();
     }
+
+    /* Clear the table for the menu */
+    stack_clear ();
+    came_from = 0xff;
+    scroll_x = 0;
+    SMS_setBGScrollX (scroll_x);
+    clear_background ();
+    indicator_shown = 0xff;
+
+    demo_playing = false;
+    in_menu = true;
 }
 
 
@@ -1222,30 +1938,28 @@ void next_palette (void)
     }
 }
 
-void manageScroll()
+/*
+ * Show the chosen difficulty in the corner of the Start card, as 1, 2 or 3,
+ * and mark the corner of the Arrow card when the cursor snaps.
+ */
+void menu_corners_render (void)
 {
-//scrollX=(cursor_stack-6)*8;
-//if(scrollX>48)scrollX=48;
-
-if(cursor_stack==CURSOR_COLUMN_1  || cursor_stack==CURSOR_DRAGON_SLOT_1)scrollX=48;//48
-else if(cursor_stack==CURSOR_COLUMN_2 || cursor_stack==CURSOR_DRAGON_SLOT_2)scrollX=38;//40
-else if(cursor_stack==CURSOR_COLUMN_3 || cursor_stack==CURSOR_DRAGON_SLOT_3)scrollX=28;//32
-else if(cursor_stack==CURSOR_COLUMN_4 || cursor_stack==CURSOR_DRAGON_BUTTONS)scrollX=18;//24
-else if(cursor_stack==CURSOR_COLUMN_5 || cursor_stack==CURSOR_FOUNDATION_SNEP)scrollX=8;//16
-else if(cursor_stack==CURSOR_COLUMN_6 || cursor_stack==CURSOR_FOUNDATION_1)scrollX=238;//8
-else if(cursor_stack==CURSOR_COLUMN_7 || cursor_stack==CURSOR_FOUNDATION_2)scrollX=228;//0
-else if(cursor_stack==CURSOR_COLUMN_8 || cursor_stack==CURSOR_FOUNDATION_3)scrollX=208;//216
-//else scrollX=0;
-
-SMS_setBGScrollX(scrollX);
+    /* Plain corners until their tiles have streamed in */
+    bool loaded = patterns_loaded >= CORNER_SNEP;
+    uint16_t tile = loaded ? CORNER_NUMBERS + difficulty * 6 : BLANK_CARD;
+
+    SMS_loadTileMapArea (8, 10, &tile, 1, 1);
+
+    tile = (cursor_snap && loaded) ? CORNER_PRINTS : BLANK_CARD;
+    SMS_loadTileMapArea (16, 10, &tile, 1, 1);
 }
 
+
 /*
- * Main menu.
+ * Draw the main menu.
  */
-void menu (void)
+void menu_render (void)
 {
-
     uint16_t card_tiles [] = {
         BLANK_CARD +  0, BLANK_CARD +  2, BLANK_CARD +  2, BLANK_CARD +  3,
         //BLANK_CARD +  5, BLANK_CARD +  6, BLANK_CARD +  6, BLANK_CARD +  7,
@@ -1265,30 +1979,68 @@ void menu (void)
     /* Render menu cards */
     for (uint8_t i = 0; i < 3; i++)
     {
-        uint16_t tile = MENU_TEXT + (4 * i);
-        card_tiles [4] = tile;//4
-        card_tiles [5] = tile + 1;//5
-        card_tiles [6] = tile + 2;//6
-        card_tiles [7] = tile + 3;//7
-
-        tile = MENU_ICONS + (4 * i);
-        card_tiles [9] = tile;//13
-        card_tiles [10] = tile + 1;//14
-        card_tiles [13] = tile + 2;//17
-        card_tiles [14] = tile + 3;//18
+        card_tiles [4] = menu_text [i] [0];//4
+        card_tiles [5] = menu_text [i] [1];//5
+        card_tiles [6] = menu_text [i] [2];//6
+        card_tiles [7] = menu_text [i] [3];//7
+
+        card_tiles [9] = menu_icons [i] [0];//13
+        card_tiles [10] = menu_icons [i] [1];//14
+        card_tiles [13] = menu_icons [i] [2];//17
+        card_tiles [14] = menu_icons [i] [3];//18
 //SMS_loadTileMapArea (unsigned char x, unsigned char y,  unsigned int *src, unsigned char width, unsigned char height);
         SMS_loadTileMapArea ((4 * (i + 2)), 10, &card_tiles, 4, 4);// last parameter height 6->4  //2nd parameter Y 9->8
     }
+    menu_corners_render ();
+
+#ifdef DEBUG_OVERLAY
+    debug_render (0);
+#endif
+}
+
+
+/*
+ * Main menu. Left alone, it plays the demo.
+ */
+void menu (void)
+{
+    uint16_t idle = 0;
+    bool corners_changed = false;
+
+    menu_render ();
+    input_flush ();
 
     while (in_menu)
     {
+        uint16_t keys_pressed = input_read ();
 
-        static uint16_t keys_previous = 0;
-        uint16_t keys = SMS_getKeysStatus ();
-        uint16_t keys_pressed = (keys & ~keys_previous);
+        if (keys_pressed != 0)
+        {
+            idle = 0;
+        }
+        else if (++idle == DEMO_IDLE_FRAMES)
+        {
+            demo ();
+            menu_render ();
+            input_flush ();
+            idle = 0;
+            continue;
+        }
 
         /* Logic */
-        if (keys_pressed & PORT_A_KEY_DPAD)
+        if ((keys_pressed & (PORT_A_KEY_UP | PORT_A_KEY_DOWN)) && cursor_stack == 2)
+        {
+            /* Up and down on Start choose the difficulty */
+            difficulty = (keys_pressed & PORT_A_KEY_UP) ? (difficulty + 1) % 3 : (difficulty + 2) % 3;
+            corners_changed = true;
+        }
+        else if ((keys_pressed & (PORT_A_KEY_UP | PORT_A_KEY_DOWN)) && cursor_stack == 4)
+        {
+            /* Up and down on Arrow choose whether the held cards snap between legal places */
+            cursor_snap = !cursor_snap;
+            corners_changed = true;
+        }
+        else if (keys_pressed & PORT_A_KEY_DPAD)
         {
             cursor_move (keys_pressed);
         }
@@ -1314,8 +2066,6 @@ void menu (void)
             }
         }
 
-        keys_previous = keys;
-
         SMS_waitForVBlank ();
 
         if (sprite_update)
@@ -1323,12 +2073,35 @@ void menu (void)
             SMS_copySpritestoSAT ();
             sprite_update = false;
         }
+
+        /* The name table first, while still in VBlank */
+        if (corners_changed)
+        {
+            menu_corners_render ();
+            corners_changed = false;
+        }
+
+        /* Then stream in the card faces, showing the menu's corners next frame once theirs are in */
+        if (patterns_loaded < PATTERN_BACKGROUND_TILE)
+        {
+            uint16_t loaded = patterns_loaded;
+
+            load_patterns_more (STREAM_TILES);
+            corners_changed |= (loaded < CORNER_SNEP && patterns_loaded >= CORNER_SNEP);
+#ifdef DEBUG_OVERLAY
+            if (patterns_loaded == PATTERN_BACKGROUND_TILE)
+            {
+                debug_render (0);
+            }
+#endif
+        }
     }
 
     memset (stack_changed, true, sizeof (stack_changed));
     render_background ();
-manageScroll();
 
+    scroll_snap (cursor_stack);
+    SMS_setBGScrollX (scroll_x);
 }
 
 
@@ -1368,13 +2141,27 @@ GG_setBGPaletteColor (0, RGB(20,0xd1,20));//background
 GG_setSpritePaletteColor (3, RGB(0x00,0xff,20));
 //end new palette stuff
 
-    SMS_loadTiles (patterns, 0, sizeof (patterns));
+    /* Frames are counted from here, for the debug overlay's boot times.
+     * BOOT_FULL debug builds start again once their raw load is done. */
+    input_init ();
+
+    load_patterns ();
+    SMS_loadTiles (indicator_tiles, INDICATOR_TILE, sizeof (indicator_tiles));
     clear_background ();
 
     SMS_useFirstHalfTilesforSprites (true);
     SMS_initSprites ();
     SMS_copySpritestoSAT ();
 
+#ifdef DEBUG_OVERLAY
+    debug_init ();
+    debug_value [2] = input_frames;
+    if (patterns_loaded == PATTERN_BACKGROUND_TILE)
+    {
+        debug_value [3] = input_frames;
+    }
+#endif
+
     SMS_displayOn ();
 
     menu ();
@@ -0,0 +1,17 @@
+/* First tile of each group in patterns.c. Tiles from OUTLINE_CARD on are only drawn on the background, and may be
+ * packed into patterns_packed.c as flips of others, so go to the name table through PATTERN_ENTRY (). */
+#define EMPTY_TILE        0
+#define CURSOR_BLACK      1
+#define CURSOR_SILVER     5
+#define CURSOR_WHITE      9
+#define BLANK_CARD       13
+#define CORNER_NUMBERS   24
+#define CORNER_PRINTS    78
+#define CORNER_SNEP      87
+#define ARTWORK_NUMBERS  90
+#define ARTWORK_PRINTS  198
+#define ARTWORK_SNEP    210
+#define OUTLINE_CARD    226
+#define BUTTON_TILES    234
+#define MENU_TEXT       258
+#define MENU_ICONS      270
@@ -0,0 +1,279 @@
+/*
+ * Tile patterns for tiles_unpack (), generated by
+ *   tiles -f 226 -o source/patterns_packed.c source/patterns.c
+ * 266 tiles kept, 8512 bytes packed into 2774 (32.6%).
+ */
+
+#define PATTERN_TILES 266
+
+/* First background-only tile, and where its packed data starts, to load them on their own */
+#define PATTERN_BACKGROUND_TILE 226
+#define PATTERN_BACKGROUND_OFFSET 2343
+
+/* Name table entry for tile (n) of patterns.c, as a constant: the tile it is kept as, and any flips */
+#define PATTERN_ENTRY(n) ( \
+    (n) < 228 ? (n) : \
+    (n) == 228 ? (226 | TILE_FLIPPED_X) : \
+    (n) < 230 ? (n) - 1 : \
+    (n) == 230 ? (228 | TILE_FLIPPED_X) : \
+    (n) == 231 ? (226 | TILE_FLIPPED_Y) : \
+    (n) == 232 ? (227 | TILE_FLIPPED_Y) : \
+    (n) == 233 ? (226 | TILE_FLIPPED_X | TILE_FLIPPED_Y) : \
+    (n) < 237 ? (n) - 5 : \
+    (n) == 237 ? (231 | TILE_FLIPPED_X) : \
+    (n) < 241 ? (n) - 6 : \
+    (n) == 241 ? (234 | TILE_FLIPPED_X) : \
+    (n) < 243 ? (n) - 7 : \
+    (n) == 243 ? (235 | TILE_FLIPPED_X) : \
+    (n) < 245 ? (n) - 8 : \
+    (n) == 245 ? (236 | TILE_FLIPPED_X) : \
+    (n) < 247 ? (n) - 9 : \
+    (n) == 247 ? (237 | TILE_FLIPPED_X) : \
+    (n) < 249 ? (n) - 10 : \
+    (n) == 249 ? (238 | TILE_FLIPPED_X) : \
+    (n) < 251 ? (n) - 11 : \
+    (n) == 251 ? (239 | TILE_FLIPPED_X) : \
+    (n) < 253 ? (n) - 12 : \
+    (n) == 253 ? (240 | TILE_FLIPPED_X) : \
+    (n) < 255 ? (n) - 13 : \
+    (n) == 255 ? (241 | TILE_FLIPPED_X) : \
+    (n) < 257 ? (n) - 14 : \
+    (n) == 257 ? (242 | TILE_FLIPPED_X) : \
+    (n) < 270 ? (n) - 15 : \
+    (n) == 270 ? (19) : \
+    (n) - 16)
+
+const uint8_t patterns_packed [2774] = {
+    0x00, 0xf0, 0xff, 0xc0, 0xa0, 0x90, 0x88, 0x84, 0x82, 0x81, 0x80, 0xfe,
+    0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 0xe0, 0x01, 0x80, 0x00, 0xf0,
+    0xff, 0x80, 0x83, 0x92, 0xa9, 0xc9, 0x84, 0x04, 0x03, 0xbf, 0xff, 0xfe,
+    0xef, 0xcf, 0x87, 0x07, 0x03, 0xf0, 0xe4, 0x40, 0xe0, 0x00, 0x80, 0xe4,
+    0xc0, 0xe0, 0x00, 0x80, 0xfc, 0x4a, 0x80, 0xc0, 0xe0, 0xff, 0x80, 0xc0,
+    0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 0x7f, 0x80, 0xc0, 0xe0, 0xb0, 0xb8,
+    0x9c, 0x9e, 0x00, 0xfc, 0xf7, 0xf0, 0xe0, 0xc8, 0x8c, 0x06, 0x04, 0x00,
+    0xbf, 0xff, 0xfe, 0xef, 0xcf, 0x87, 0x07, 0x03, 0xff, 0x8f, 0x90, 0xa4,
+    0xca, 0x8a, 0x05, 0x07, 0x00, 0x30, 0xe4, 0x80, 0xc0, 0x00, 0x80, 0xf0,
+    0x7f, 0x40, 0x60, 0x70, 0x78, 0x7c, 0x7e, 0x7f, 0xfe, 0xc0, 0xe0, 0xf0,
+    0xf8, 0xfc, 0xfe, 0xff, 0x30, 0x01, 0x80, 0xf0, 0xfd, 0x7f, 0x7c, 0x6c,
+    0x46, 0x06, 0x03, 0x00, 0xbf, 0xff, 0xfe, 0xef, 0xcf, 0x87, 0x07, 0x03,
+    0xf0, 0xc0, 0x80, 0x00, 0xe4, 0xc0, 0xe0, 0x00, 0x80, 0xf0, 0x70, 0x07,
+    0x0f, 0x1f, 0xf0, 0x07, 0x0f, 0x1f, 0x3f, 0xf0, 0xf0, 0x18, 0x17, 0x0f,
+    0x1f, 0x80, 0x3f, 0xd0, 0x40, 0xff, 0xf0, 0x70, 0xe0, 0xf0, 0xf8, 0xf0,
+    0xe0, 0xf0, 0xf8, 0xfc, 0xf0, 0xf0, 0x18, 0xe8, 0xf0, 0xf8, 0x80, 0xfc,
+    0xf0, 0x80, 0x1f, 0x80, 0x3f, 0x50, 0xf0, 0x80, 0xf8, 0x80, 0xfc, 0xf0,
+    0x87, 0x1f, 0x0f, 0x07, 0x00, 0x87, 0x3f, 0x1f, 0x0f, 0x07, 0xd0, 0x81,
+    0xff, 0x00, 0xf0, 0x87, 0xf8, 0xf0, 0xe0, 0x00, 0x87, 0xfc, 0xf8, 0xf0,
+    0xe0, 0xf0, 0x7b, 0x07, 0x0d, 0x19, 0x1d, 0x18, 0x1f, 0xf0, 0x07, 0x0f,
+    0x1f, 0x3f, 0xf0, 0xfb, 0x18, 0x17, 0x0d, 0x19, 0x1d, 0x18, 0x1f, 0x80,
+    0x3f, 0xfc, 0x7b, 0x07, 0x0d, 0x19, 0x1d, 0x18, 0x1f, 0xfb, 0x07, 0x0f,
+    0x1d, 0x39, 0x3d, 0x38, 0x3f, 0x3b, 0x02, 0x06, 0x02, 0x07, 0x00, 0xfc,
+    0xfb, 0x18, 0x17, 0x0d, 0x19, 0x1d, 0x18, 0x1f, 0xbb, 0x3f, 0x3d, 0x39,
+    0x3d, 0x38, 0x3f, 0x3b, 0x02, 0x06, 0x02, 0x07, 0x00, 0xfc, 0x70, 0x07,
+    0x0f, 0x1f, 0xfb, 0x07, 0x0f, 0x1d, 0x39, 0x3d, 0x38, 0x3f, 0x3b, 0x02,
+    0x06, 0x02, 0x07, 0x00, 0xfc, 0xf0, 0x18, 0x17, 0x0f, 0x1f, 0xbb, 0x3f,
+    0x3d, 0x39, 0x3d, 0x38, 0x3f, 0x3b, 0x02, 0x06, 0x02, 0x07, 0x00, 0xf0,
+    0x7f, 0x07, 0x09, 0x1e, 0x18, 0x1b, 0x18, 0x1f, 0xf0, 0x07, 0x0f, 0x1f,
+    0x3f, 0xf0, 0xff, 0x18, 0x17, 0x09, 0x1e, 0x18, 0x1b, 0x18, 0x1f, 0x80,
+    0x3f, 0xfc, 0x7f, 0x07, 0x09, 0x1e, 0x18, 0x1b, 0x18, 0x1f, 0xff, 0x07,
+    0x0f, 0x19, 0x3e, 0x38, 0x3b, 0x38, 0x3f, 0x3f, 0x06, 0x01, 0x07, 0x04,
+    0x07, 0x00, 0xfc, 0xff, 0x18, 0x17, 0x09, 0x1e, 0x18, 0x1b, 0x18, 0x1f,
+    0xbf, 0x3f, 0x39, 0x3e, 0x38, 0x3b, 0x38, 0x3f, 0x3f, 0x06, 0x01, 0x07,
+    0x04, 0x07, 0x00, 0xfc, 0x70, 0x07, 0x0f, 0x1f, 0xff, 0x07, 0x0f, 0x19,
+    0x3e, 0x38, 0x3b, 0x38, 0x3f, 0x3f, 0x06, 0x01, 0x07, 0x04, 0x07, 0x00,
+    0xfc, 0xf0, 0x18, 0x17, 0x0f, 0x1f, 0xbf, 0x3f, 0x39, 0x3e, 0x38, 0x3b,
+    0x38, 0x3f, 0x3f, 0x06, 0x01, 0x07, 0x04, 0x07, 0x00, 0xf0, 0x7f, 0x07,
+    0x08, 0x1e, 0x1c, 0x1e, 0x18, 0x1f, 0xf0, 0x07, 0x0f, 0x1f, 0x3f, 0xf0,
+    0xff, 0x18, 0x17, 0x08, 0x1e, 0x1c, 0x1e, 0x18, 0x1f, 0x80, 0x3f, 0xfc,
+    0x7f, 0x07, 0x08, 0x1e, 0x1c, 0x1e, 0x18, 0x1f, 0xff, 0x07, 0x0f, 0x18,
+    0x3e, 0x3c, 0x3e, 0x38, 0x3f, 0x3f, 0x07, 0x01, 0x03, 0x01, 0x07, 0x00,
+    0xfc, 0xff, 0x18, 0x17, 0x08, 0x1e, 0x1c, 0x1e, 0x18, 0x1f, 0xbf, 0x3f,
+    0x38, 0x3e, 0x3c, 0x3e, 0x38, 0x3f, 0x3f, 0x07, 0x01, 0x03, 0x01, 0x07,
+    0x00, 0xfc, 0x70, 0x07, 0x0f, 0x1f, 0xff, 0x07, 0x0f, 0x18, 0x3e, 0x3c,
+    0x3e, 0x38, 0x3f, 0x3f, 0x07, 0x01, 0x03, 0x01, 0x07, 0x00, 0xfc, 0xf0,
+    0x18, 0x17, 0x0f, 0x1f, 0xbf, 0x3f, 0x38, 0x3e, 0x3c, 0x3e, 0x38, 0x3f,
+    0x3f, 0x07, 0x01, 0x03, 0x01, 0x07, 0x00, 0xf0, 0x7d, 0x07, 0x0a, 0x1a,
+    0x18, 0x1e, 0x1f, 0xf0, 0x07, 0x0f, 0x1f, 0x3f, 0xf0, 0xfd, 0x18, 0x17,
+    0x0a, 0x1a, 0x18, 0x1e, 0x1f, 0x80, 0x3f, 0xfc, 0x7d, 0x07, 0x0a, 0x1a,
+    0x18, 0x1e, 0x1f, 0xfd, 0x07, 0x0f, 0x1a, 0x3a, 0x38, 0x3e, 0x3f, 0x2d,
+    0x05, 0x07, 0x01, 0x00, 0xfc, 0xfd, 0x18, 0x17, 0x0a, 0x1a, 0x18, 0x1e,
+    0x1f, 0xad, 0x3f, 0x3a, 0x38, 0x3e, 0x3f, 0x2d, 0x05, 0x07, 0x01, 0x00,
+    0xfc, 0x70, 0x07, 0x0f, 0x1f, 0xfd, 0x07, 0x0f, 0x1a, 0x3a, 0x38, 0x3e,
+    0x3f, 0x2d, 0x05, 0x07, 0x01, 0x00, 0xfc, 0xf0, 0x18, 0x17, 0x0f, 0x1f,
+    0xad, 0x3f, 0x3a, 0x38, 0x3e, 0x3f, 0x2d, 0x05, 0x07, 0x01, 0x00, 0xf0,
+    0x7f, 0x07, 0x08, 0x1b, 0x18, 0x1e, 0x19, 0x1f, 0xf0, 0x07, 0x0f, 0x1f,
+    0x3f, 0xf0, 0xff, 0x18, 0x17, 0x08, 0x1b, 0x18, 0x1e, 0x19, 0x1f, 0x80,
+    0x3f, 0xfc, 0x7f, 0x07, 0x08, 0x1b, 0x18, 0x1e, 0x19, 0x1f, 0xff, 0x07,
+    0x0f, 0x18, 0x3b, 0x38, 0x3e, 0x39, 0x3f, 0x3f, 0x07, 0x04, 0x07, 0x01,
+    0x06, 0x00, 0xfc, 0xff, 0x18, 0x17, 0x08, 0x1b, 0x18, 0x1e, 0x19, 0x1f,
+    0xbf, 0x3f, 0x38, 0x3b, 0x38, 0x3e, 0x39, 0x3f, 0x3f, 0x07, 0x04, 0x07,
+    0x01, 0x06, 0x00, 0xfc, 0x70, 0x07, 0x0f, 0x1f, 0xff, 0x07, 0x0f, 0x18,
+    0x3b, 0x38, 0x3e, 0x39, 0x3f, 0x3f, 0x07, 0x04, 0x07, 0x01, 0x06, 0x00,
+    0xfc, 0xf0, 0x18, 0x17, 0x0f, 0x1f, 0xbf, 0x3f, 0x38, 0x3b, 0x38, 0x3e,
+    0x39, 0x3f, 0x3f, 0x07, 0x04, 0x07, 0x01, 0x06, 0x00, 0xf0, 0x7f, 0x07,
+    0x0c, 0x1b, 0x18, 0x1a, 0x18, 0x1f, 0xf0, 0x07, 0x0f, 0x1f, 0x3f, 0xf0,
+    0xff, 0x18, 0x17, 0x0c, 0x1b, 0x18, 0x1a, 0x18, 0x1f, 0x80, 0x3f, 0xfc,
+    0x7f, 0x07, 0x0c, 0x1b, 0x18, 0x1a, 0x18, 0x1f, 0xff, 0x07, 0x0f, 0x1c,
+    0x3b, 0x38, 0x3a, 0x38, 0x3f, 0x3f, 0x03, 0x04, 0x07, 0x05, 0x07, 0x00,
+    0xfc, 0xff, 0x18, 0x17, 0x0c, 0x1b, 0x18, 0x1a, 0x18, 0x1f, 0xbf, 0x3f,
+    0x3c, 0x3b, 0x38, 0x3a, 0x38, 0x3f, 0x3f, 0x03, 0x04, 0x07, 0x05, 0x07,
+    0x00, 0xfc, 0x70, 0x07, 0x0f, 0x1f, 0xff, 0x07, 0x0f, 0x1c, 0x3b, 0x38,
+    0x3a, 0x38, 0x3f, 0x3f, 0x03, 0x04, 0x07, 0x05, 0x07, 0x00, 0xfc, 0xf0,
+    0x18, 0x17, 0x0f, 0x1f, 0xbf, 0x3f, 0x3c, 0x3b, 0x38, 0x3a, 0x38, 0x3f,
+    0x3f, 0x03, 0x04, 0x07, 0x05, 0x07, 0x00, 0xf0, 0x79, 0x07, 0x08, 0x1e,
+    0x1d, 0x1f, 0xf0, 0x07, 0x0f, 0x1f, 0x3f, 0xf0, 0xf9, 0x18, 0x17, 0x08,
+    0x1e, 0x1d, 0x1f, 0x80, 0x3f, 0xfc, 0x79, 0x07, 0x08, 0x1e, 0x1d, 0x1f,
+    0xf9, 0x07, 0x0f, 0x18, 0x3e, 0x3d, 0x3f, 0x39, 0x07, 0x01, 0x02, 0x00,
+    0xfc, 0xf9, 0x18, 0x17, 0x08, 0x1e, 0x1d, 0x1f, 0xb9, 0x3f, 0x38, 0x3e,
+    0x3d, 0x3f, 0x39, 0x07, 0x01, 0x02, 0x00, 0xfc, 0x70, 0x07, 0x0f, 0x1f,
+    0xf9, 0x07, 0x0f, 0x18, 0x3e, 0x3d, 0x3f, 0x39, 0x07, 0x01, 0x02, 0x00,
+    0xfc, 0xf0, 0x18, 0x17, 0x0f, 0x1f, 0xb9, 0x3f, 0x38, 0x3e, 0x3d, 0x3f,
+    0x39, 0x07, 0x01, 0x02, 0x00, 0xf0, 0x7f, 0x07, 0x08, 0x1a, 0x18, 0x1a,
+    0x18, 0x1f, 0xf0, 0x07, 0x0f, 0x1f, 0x3f, 0xf0, 0xff, 0x18, 0x17, 0x08,
+    0x1a, 0x18, 0x1a, 0x18, 0x1f, 0x80, 0x3f, 0xfc, 0x7f, 0x07, 0x08, 0x1a,
+    0x18, 0x1a, 0x18, 0x1f, 0xff, 0x07, 0x0f, 0x18, 0x3a, 0x38, 0x3a, 0x38,
+    0x3f, 0x3f, 0x07, 0x05, 0x07, 0x05, 0x07, 0x00, 0xfc, 0xff, 0x18, 0x17,
+    0x08, 0x1a, 0x18, 0x1a, 0x18, 0x1f, 0xbf, 0x3f, 0x38, 0x3a, 0x38, 0x3a,
+    0x38, 0x3f, 0x3f, 0x07, 0x05, 0x07, 0x05, 0x07, 0x00, 0xfc, 0x70, 0x07,
+    0x0f, 0x1f, 0xff, 0x07, 0x0f, 0x18, 0x3a, 0x38, 0x3a, 0x38, 0x3f, 0x3f,
+    0x07, 0x05, 0x07, 0x05, 0x07, 0x00, 0xfc, 0xf0, 0x18, 0x17, 0x0f, 0x1f,
+    0xbf, 0x3f, 0x38, 0x3a, 0x38, 0x3a, 0x38, 0x3f, 0x3f, 0x07, 0x05, 0x07,
+    0x05, 0x07, 0x00, 0xf0, 0x7d, 0x07, 0x08, 0x1a, 0x18, 0x1e, 0x1f, 0xf0,
+    0x07, 0x0f, 0x1f, 0x3f, 0xf0, 0xfd, 0x18, 0x17, 0x08, 0x1a, 0x18, 0x1e,
+    0x1f, 0x80, 0x3f, 0xfc, 0x7d, 0x07, 0x08, 0x1a, 0x18, 0x1e, 0x1f, 0xfd,
+    0x07, 0x0f, 0x18, 0x3a, 0x38, 0x3e, 0x3f, 0x3d, 0x07, 0x05, 0x07, 0x01,
+    0x00, 0xfc, 0xfd, 0x18, 0x17, 0x08, 0x1a, 0x18, 0x1e, 0x1f, 0xbd, 0x3f,
+    0x38, 0x3a, 0x38, 0x3e, 0x3f, 0x3d, 0x07, 0x05, 0x07, 0x01, 0x00, 0xfc,
+    0x70, 0x07, 0x0f, 0x1f, 0xfd, 0x07, 0x0f, 0x18, 0x3a, 0x38, 0x3e, 0x3f,
+    0x3d, 0x07, 0x05, 0x07, 0x01, 0x00, 0xfc, 0xf0, 0x18, 0x17, 0x0f, 0x1f,
+    0xbd, 0x3f, 0x38, 0x3a, 0x38, 0x3e, 0x3f, 0x3d, 0x07, 0x05, 0x07, 0x01,
+    0x00, 0xf0, 0x7f, 0x07, 0x0e, 0x1e, 0x1a, 0x1c, 0x1e, 0x1f, 0xf0, 0x07,
+    0x0f, 0x1f, 0x3f, 0xf0, 0xff, 0x18, 0x17, 0x0e, 0x1e, 0x1a, 0x1c, 0x1e,
+    0x1f, 0x80, 0x3f, 0xd0, 0x4e, 0xff, 0xbf, 0x7f, 0xff, 0xfc, 0x7d, 0x07,
+    0x0e, 0x1b, 0x1e, 0x1c, 0x1f, 0xfd, 0x07, 0x0f, 0x1e, 0x3b, 0x3e, 0x3c,
+    0x3f, 0x3d, 0x01, 0x04, 0x01, 0x03, 0x00, 0xfc, 0xfd, 0x18, 0x17, 0x0e,
+    0x1b, 0x1e, 0x1c, 0x1f, 0xbd, 0x3f, 0x3e, 0x3b, 0x3e, 0x3c, 0x3f, 0x3d,
+    0x01, 0x04, 0x01, 0x03, 0x00, 0xf8, 0x5d, 0xff, 0xbf, 0xff, 0x7f, 0xff,
+    0x9d, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0x81, 0xfc, 0x70, 0x07, 0x0f, 0x1f,
+    0xf7, 0x07, 0x0f, 0x1d, 0x39, 0x3f, 0x3d, 0x3f, 0x37, 0x02, 0x06, 0x00,
+    0x02, 0x00, 0xfc, 0xf0, 0x18, 0x17, 0x0f, 0x1f, 0xb7, 0x3f, 0x3d, 0x39,
+    0x3f, 0x3d, 0x3f, 0x37, 0x02, 0x06, 0x00, 0x02, 0x00, 0xf8, 0x40, 0xff,
+    0xb7, 0xff, 0x7f, 0x3f, 0xff, 0x7f, 0xff, 0x81, 0xfc, 0x78, 0x07, 0x0f,
+    0x1f, 0x19, 0xf0, 0x07, 0x0f, 0x1f, 0x3f, 0x18, 0x06, 0x0f, 0xfc, 0xf8,
+    0x18, 0x17, 0x0f, 0x1f, 0x19, 0x80, 0x3f, 0x18, 0x06, 0x0f, 0xf0, 0x87,
+    0xf8, 0xf0, 0xe0, 0x00, 0x87, 0xfc, 0xf8, 0xf0, 0xe0, 0xd0, 0x81, 0xff,
+    0x00, 0xd0, 0x81, 0xff, 0x01, 0x50, 0x50, 0xe8, 0x81, 0xff, 0x00, 0x00,
+    0x80, 0xe8, 0x81, 0xff, 0x01, 0x00, 0x80, 0x50, 0x50, 0x78, 0x81, 0xff,
+    0x00, 0x81, 0x78, 0x81, 0xff, 0x01, 0x81, 0x50, 0x50, 0xd0, 0x98, 0xff,
+    0xc0, 0xff, 0xd0, 0x98, 0xff, 0x07, 0xff, 0xd0, 0x8c, 0xff, 0x00, 0xff,
+    0xd0, 0x8c, 0xff, 0x01, 0xff, 0xe8, 0x98, 0xff, 0xc0, 0xff, 0x00, 0x80,
+    0xe8, 0x98, 0xff, 0x07, 0xff, 0x00, 0x80, 0xe8, 0x8c, 0xff, 0x00, 0xff,
+    0x00, 0x80, 0xe8, 0x8c, 0xff, 0x01, 0xff, 0x00, 0x80, 0x78, 0x98, 0xff,
+    0xc0, 0xff, 0x81, 0x78, 0x98, 0xff, 0x07, 0xff, 0x81, 0x78, 0x8c, 0xff,
+    0x00, 0xff, 0x81, 0x78, 0x8c, 0xff, 0x01, 0xff, 0x81, 0xd0, 0xb1, 0xff,
+    0x80, 0xff, 0xc0, 0xd0, 0xb1, 0xff, 0x03, 0xff, 0x07, 0xd0, 0x86, 0xff,
+    0x00, 0xff, 0xd0, 0x86, 0xff, 0x01, 0xff, 0xe8, 0xb1, 0xff, 0x80, 0xff,
+    0xc0, 0x00, 0x80, 0xe8, 0xb1, 0xff, 0x03, 0xff, 0x07, 0x00, 0x80, 0xe8,
+    0x86, 0xff, 0x00, 0xff, 0x00, 0x80, 0xe8, 0x86, 0xff, 0x01, 0xff, 0x00,
+    0x80, 0x78, 0xb1, 0xff, 0x80, 0xff, 0xc0, 0x81, 0x78, 0xb1, 0xff, 0x03,
+    0xff, 0x07, 0x81, 0x78, 0x86, 0xff, 0x00, 0xff, 0x81, 0x78, 0x86, 0xff,
+    0x01, 0xff, 0x81, 0xd0, 0xb0, 0xff, 0x80, 0xbb, 0xd0, 0xb0, 0xff, 0x03,
+    0xbb, 0xd0, 0xbf, 0xb7, 0xaf, 0x9f, 0xbf, 0x80, 0xbf, 0xff, 0xd0, 0xe7,
+    0xbb, 0xc3, 0xfb, 0x03, 0xfb, 0xff, 0xe8, 0xb0, 0xff, 0x80, 0xbb, 0x00,
+    0x80, 0xe8, 0xb0, 0xff, 0x03, 0xbb, 0x00, 0x80, 0xe8, 0xbf, 0xb7, 0xaf,
+    0x9f, 0xbf, 0x80, 0xbf, 0xff, 0x00, 0x80, 0xe8, 0xe7, 0xbb, 0xc3, 0xfb,
+    0x03, 0xfb, 0xff, 0x00, 0x80, 0x78, 0xb0, 0xff, 0x80, 0xbb, 0x81, 0x78,
+    0xb0, 0xff, 0x03, 0xbb, 0x81, 0x78, 0xbf, 0xb7, 0xaf, 0x9f, 0xbf, 0x80,
+    0xbf, 0xff, 0x81, 0x78, 0xe7, 0xbb, 0xc3, 0xfb, 0x03, 0xfb, 0xff, 0x81,
+    0xd0, 0xe3, 0xff, 0x80, 0xfd, 0xc0, 0xfb, 0xd0, 0xe3, 0xff, 0x03, 0xff,
+    0x0f, 0xef, 0xd0, 0x93, 0xfb, 0xf7, 0x00, 0xff, 0xd0, 0x83, 0xef, 0x01,
+    0xff, 0xe8, 0xe3, 0xff, 0x80, 0xfd, 0xc0, 0xfb, 0x00, 0x80, 0xe8, 0xe3,
+    0xff, 0x03, 0xff, 0x0f, 0xef, 0x00, 0x80, 0xe8, 0x93, 0xfb, 0xf7, 0x00,
+    0xff, 0x00, 0x80, 0xe8, 0x83, 0xef, 0x01, 0xff, 0x00, 0x80, 0x78, 0xe3,
+    0xff, 0x80, 0xfd, 0xc0, 0xfb, 0x81, 0x78, 0xe3, 0xff, 0x03, 0xff, 0x0f,
+    0xef, 0x81, 0x78, 0x93, 0xfb, 0xf7, 0x00, 0xff, 0x81, 0x78, 0x83, 0xef,
+    0x01, 0xff, 0x81, 0xd0, 0xe6, 0xfd, 0xfe, 0xff, 0x00, 0xff, 0xd0, 0xae,
+    0xff, 0x7f, 0xff, 0x01, 0xff, 0xd0, 0xaf, 0xfb, 0xf7, 0xef, 0xdf, 0xbf,
+    0xff, 0xd0, 0xf5, 0xbf, 0xdf, 0xef, 0xf7, 0xfb, 0xff, 0xe8, 0xe6, 0xfd,
+    0xfe, 0xff, 0x00, 0xff, 0x00, 0x80, 0xe8, 0xae, 0xff, 0x7f, 0xff, 0x01,
+    0xff, 0x00, 0x80, 0xe8, 0xaf, 0xfb, 0xf7, 0xef, 0xdf, 0xbf, 0xff, 0x00,
+    0x80, 0xe8, 0xf5, 0xbf, 0xdf, 0xef, 0xf7, 0xfb, 0xff, 0x00, 0x80, 0x78,
+    0xe6, 0xfd, 0xfe, 0xff, 0x00, 0xff, 0x81, 0x78, 0xae, 0xff, 0x7f, 0xff,
+    0x01, 0xff, 0x81, 0x78, 0xaf, 0xfb, 0xf7, 0xef, 0xdf, 0xbf, 0xff, 0x81,
+    0x78, 0xf5, 0xbf, 0xdf, 0xef, 0xf7, 0xfb, 0xff, 0x81, 0xd0, 0x83, 0xfd,
+    0xf8, 0x05, 0xd0, 0x87, 0xff, 0xc3, 0x3f, 0xff, 0xd0, 0x83, 0xfd, 0xfe,
+    0xff, 0xd0, 0x93, 0xff, 0xfb, 0x03, 0xff, 0xe8, 0x83, 0xfd, 0xf8, 0x05,
+    0x00, 0x80, 0xe8, 0x87, 0xff, 0xc3, 0x3f, 0xff, 0x00, 0x80, 0xe8, 0x83,
+    0xfd, 0xfe, 0xff, 0x00, 0x80, 0xe8, 0x93, 0xff, 0xfb, 0x03, 0xff, 0x00,
+    0x80, 0x78, 0x83, 0xfd, 0xf8, 0x05, 0x81, 0x78, 0x87, 0xff, 0xc3, 0x3f,
+    0xff, 0x81, 0x78, 0x83, 0xfd, 0xfe, 0xff, 0x81, 0x78, 0x93, 0xff, 0xfb,
+    0x03, 0xff, 0x81, 0xd0, 0xa0, 0xff, 0xfb, 0xd0, 0xc1, 0xff, 0xbf, 0xdf,
+    0xd0, 0x95, 0xf7, 0xef, 0xdf, 0xbf, 0xd0, 0xab, 0xdf, 0xef, 0xf7, 0xfb,
+    0xfd, 0xe8, 0xa0, 0xff, 0xfb, 0x00, 0x80, 0xe8, 0xc1, 0xff, 0xbf, 0xdf,
+    0x00, 0x80, 0xe8, 0x95, 0xf7, 0xef, 0xdf, 0xbf, 0x00, 0x80, 0xe8, 0xab,
+    0xdf, 0xef, 0xf7, 0xfb, 0xfd, 0x00, 0x80, 0x78, 0xa0, 0xff, 0xfb, 0x81,
+    0x78, 0xc1, 0xff, 0xbf, 0xdf, 0x81, 0x78, 0x95, 0xf7, 0xef, 0xdf, 0xbf,
+    0x81, 0x78, 0xab, 0xdf, 0xef, 0xf7, 0xfb, 0xfd, 0x81, 0xd0, 0x8c, 0xfb,
+    0x80, 0xfb, 0xd0, 0x8c, 0xff, 0x1f, 0xdf, 0xd0, 0x97, 0xf7, 0xef, 0xdf,
+    0xbf, 0x7f, 0xd0, 0x93, 0xdf, 0xdd, 0xe1, 0xff, 0xe8, 0x8c, 0xfb, 0x80,
+    0xfb, 0x00, 0x80, 0xe8, 0x8c, 0xff, 0x1f, 0xdf, 0x00, 0x80, 0xe8, 0x97,
+    0xf7, 0xef, 0xdf, 0xbf, 0x7f, 0x00, 0x80, 0xe8, 0x93, 0xdf, 0xdd, 0xe1,
+    0xff, 0x00, 0x80, 0x78, 0x8c, 0xfb, 0x80, 0xfb, 0x81, 0x78, 0x8c, 0xff,
+    0x1f, 0xdf, 0x81, 0x78, 0x97, 0xf7, 0xef, 0xdf, 0xbf, 0x7f, 0x81, 0x78,
+    0x93, 0xdf, 0xdd, 0xe1, 0xff, 0x81, 0xd0, 0xc3, 0xff, 0xfe, 0x7e, 0x3e,
+    0xd0, 0xa3, 0xff, 0x7f, 0x7e, 0x7c, 0xd0, 0xff, 0x1e, 0x8e, 0xc6, 0xe2,
+    0xf0, 0xf8, 0xfc, 0xfe, 0xd0, 0xff, 0x78, 0x71, 0x63, 0x47, 0x0f, 0x1f,
+    0x3f, 0x7f, 0xe8, 0xee, 0xff, 0xf3, 0xe1, 0xf3, 0x9f, 0x0f, 0x00, 0x80,
+    0xe8, 0xee, 0xff, 0xcf, 0x87, 0xcf, 0xf9, 0xf0, 0x00, 0x80, 0xe8, 0xfb,
+    0x9e, 0xf8, 0xf0, 0xe0, 0xc0, 0xe0, 0xf8, 0x00, 0x80, 0xe8, 0xfb, 0x79,
+    0x1f, 0x0f, 0x07, 0x03, 0x07, 0x1f, 0x00, 0x80, 0x78, 0xdc, 0xfd, 0xf9,
+    0xf1, 0xf3, 0xe3, 0x81, 0x78, 0xdc, 0xbf, 0x9f, 0x8f, 0xcf, 0xc7, 0x81,
+    0x78, 0xba, 0xe1, 0xf1, 0xf9, 0xff, 0xf9, 0x81, 0x78, 0xba, 0x87, 0x8f,
+    0x9f, 0xff, 0x9f, 0x81, 0xfc, 0x85, 0x19, 0x1c, 0x1e, 0x80, 0x3f, 0x85,
+    0x0f, 0x07, 0x03, 0xdc, 0x81, 0xff, 0x7f, 0x05, 0x80, 0xc0, 0x50, 0xf0,
+    0x80, 0xf8, 0x80, 0xfc, 0xfc, 0xc0, 0x1e, 0x1f, 0x80, 0x3f, 0xe0, 0x03,
+    0x01, 0x00, 0xdc, 0xff, 0x3f, 0x1f, 0x8f, 0xc7, 0xe3, 0xf1, 0xf8, 0xfc,
+    0xff, 0xe0, 0xf0, 0xf8, 0x7c, 0x3e, 0x1f, 0x0f, 0x07, 0xdc, 0x81, 0xff,
+    0x7f, 0x03, 0x80, 0xc0, 0xf0, 0x80, 0xf8, 0x80, 0xfc, 0xf0, 0x80, 0x1f,
+    0x80, 0x3f, 0xdc, 0xc0, 0xfe, 0xff, 0xe0, 0x03, 0x01, 0x00, 0xdc, 0xff,
+    0x3f, 0x1f, 0x8f, 0xc7, 0xe3, 0xf1, 0xf8, 0xfc, 0xff, 0xe0, 0xf0, 0xf8,
+    0x7c, 0x3e, 0x1f, 0x0f, 0x07, 0xfc, 0x81, 0xf8, 0x78, 0x80, 0xfc, 0x03,
+    0x80, 0xc0, 0xf0, 0x80, 0x1f, 0x80, 0x3f, 0x50, 0xdc, 0xc0, 0xfe, 0xff,
+    0xd0, 0x03, 0x01, 0x00, 0xfc, 0xd0, 0x78, 0x38, 0x98, 0x80, 0xfc, 0xd0,
+    0xc0, 0xe0, 0xf0, 0xc0, 0xf0, 0x07, 0x08, 0x10, 0x20, 0xc0, 0xc0, 0xff,
+    0x00, 0xc0, 0x80, 0x20, 0xf0, 0x7a, 0x03, 0x0c, 0x10, 0x20, 0x40, 0x13,
+    0x01, 0x11, 0x19, 0xf0, 0x7a, 0xc0, 0x30, 0x08, 0x04, 0x02, 0x0b, 0x80,
+    0x88, 0x98, 0xf0, 0xaf, 0x40, 0x20, 0x10, 0x0c, 0x03, 0x00, 0xfc, 0x1d,
+    0x0f, 0x07, 0x03, 0x01, 0x00, 0xf0, 0x3b, 0x03, 0x0e, 0x1e, 0x2e, 0x26,
+    0x7b, 0x03, 0x0c, 0x11, 0x21, 0x51, 0x59, 0xf0, 0x3b, 0xc0, 0xf0, 0x78,
+    0x74, 0x64, 0x7b, 0xc0, 0x30, 0x08, 0x84, 0x8a, 0x9a, 0xf0, 0xfe, 0x22,
+    0x30, 0x18, 0x1c, 0x0e, 0x03, 0x00, 0xff, 0x5d, 0x4f, 0x27, 0x23, 0x11,
+    0x0c, 0x03, 0x00, 0xcc, 0x7a, 0x03, 0x0c, 0x10, 0x20, 0x40, 0x0b, 0x06,
+    0x00, 0x18, 0xcc, 0xaf, 0x40, 0x20, 0x10, 0x0c, 0x03, 0x00, 0xf8, 0x19,
+    0x03, 0x07, 0x03, 0x00, 0xfc, 0x3b, 0x03, 0x0f, 0x19, 0x3f, 0x27, 0x7a,
+    0x03, 0x0c, 0x10, 0x20, 0x40, 0x0b, 0x06, 0x00, 0x18, 0xfc, 0xfe, 0x26,
+    0x3c, 0x18, 0x1c, 0x0f, 0x03, 0x00, 0xaf, 0x40, 0x20, 0x10, 0x0c, 0x03,
+    0x00, 0xf8, 0x19, 0x03, 0x07, 0x03, 0x00, 0xcc, 0x7a, 0x03, 0x0c, 0x12,
+    0x26, 0x4c, 0x1a, 0x02, 0x06, 0x0c, 0xcc, 0xbf, 0x4e, 0x24, 0x20, 0x12,
+    0x0c, 0x03, 0x00, 0xbc, 0x0e, 0x04, 0x00, 0x02, 0x00, 0xfc, 0x3a, 0x03,
+    0x0f, 0x1f, 0x3f, 0x7a, 0x03, 0x0c, 0x10, 0x20, 0x40, 0x1a, 0x02, 0x06,
+    0x0c, 0xfc, 0xae, 0x3f, 0x1f, 0x0f, 0x03, 0x00, 0xaf, 0x40, 0x20, 0x10,
+    0x0c, 0x03, 0x00, 0xbc, 0x0e, 0x04, 0x00, 0x02, 0x00, 0xf0, 0xdb, 0x1c,
+    0x1b, 0x1c, 0x1f, 0x18, 0x1f, 0x80, 0x3f, 0xd0, 0xfb, 0x6f, 0xef, 0xc6,
+    0xed, 0x6d, 0xf6, 0xff, 0xd0, 0xbb, 0xff, 0x2a, 0xa7, 0xaf, 0x2f, 0xff,
+    0xf0, 0xb3, 0x78, 0x38, 0x78, 0xb8, 0xf8, 0x80, 0xfc, 0xf0, 0xc1, 0x18,
+    0x1e, 0x1f, 0x80, 0x3f, 0xd0, 0xf3, 0x3e, 0xfe, 0xe2, 0xda, 0xe2, 0xff,
+    0xd0, 0xbf, 0xf7, 0x36, 0xd5, 0xd4, 0xd5, 0x36, 0xff, 0xf0, 0xbf, 0xf8,
+    0x78, 0xb8, 0x38, 0xf8, 0x38, 0xf8, 0x80, 0xfc, 0xf0, 0xd9, 0x19, 0x16,
+    0x10, 0x16, 0x1f, 0x80, 0x3f, 0xd0, 0xb9, 0xff, 0xaa, 0x99, 0xbb, 0xff,
+    0xd0, 0xb7, 0xff, 0x9a, 0x6a, 0x6d, 0x9d, 0xff, 0xf0, 0xa5, 0xf8, 0xb8,
+    0x78, 0xf8, 0x80, 0xfc, 0x78, 0xaa, 0xfc, 0xf9, 0xf3, 0xe7, 0x81, 0x78,
+    0xff, 0x3f, 0x9f, 0xcf, 0xe7, 0xf3, 0xf9, 0xfc, 0xfe, 0x81, 0x78, 0xaa,
+    0xcf, 0x9f, 0x3f, 0x7f, 0x81, 0xf2, 0x8a, 0x01, 0x0f, 0xff, 0x8a, 0x01,
+    0x00, 0xf0, 0x81, 0x72, 0x88, 0xff, 0x1f, 0x81, 0x72, 0xa0, 0xf0, 0xff,
+    0x81, 0xd2, 0x82, 0x01, 0xff, 0x80, 0xdc, 0xfa, 0xef, 0xf7, 0xf3, 0xf1,
+    0xf8, 0xfc, 0x7e, 0x10, 0x18, 0x1c, 0x16, 0x17, 0x13, 0xdc, 0x87, 0xff,
+    0x7f, 0x3f, 0x1f, 0x03, 0x80, 0xc0, 0xdc, 0xfe, 0xfe, 0xfc, 0xf9, 0xf3,
+    0xf7, 0xef, 0xff, 0xfc, 0x11, 0x12, 0x14, 0x19, 0x11, 0x00, 0xdc, 0xf6,
+    0x0f, 0x07, 0x3f, 0x9f, 0xcf, 0x8f, 0xf7, 0xe0, 0x00, 0x80, 0x40, 0xa0,
+    0xe0, 0x00
+};
@@ -0,0 +1,122 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "position.h"
+#include "stack.h"
+
+/*
+ * Zobrist hash of the live board. Each card is keyed by its place (stack and
+ * depth) plus its value, so that cards swapping places change the hash,
+ * which an exclusive-or of separate place and card keys would not. The board
+ * hash is the exclusive-or of the keys of every card on it, so a card moving
+ * costs two table reads, an add and an exclusive-or at each end.
+ */
+
+uint16_t position_hash = 0;
+
+/* The most recent positions, oldest overwritten first */
+static uint16_t history [POSITION_HISTORY];
+static uint8_t history_next = 0;
+static uint8_t history_count = 0;
+
+/* Random keys for each place, by (stack << 4) | depth, and for each card */
+const uint16_t position_place [256] = {
+    0x4965, 0xcf94, 0x5d90, 0x0cef, 0x5d98, 0xdcc8, 0x2c9d, 0x2f5e,
+    0x5268, 0x948c, 0x0b96, 0x0905, 0xb0c1, 0xb156, 0xbc11, 0x8a33,
+    0xd9ac, 0xea26, 0x381f, 0x72d2, 0x5667, 0xbbce, 0x4923, 0x2c85,
+    0x4eee, 0xafdb, 0xccc2, 0x7614, 0xe0d4, 0x0441, 0xe702, 0x8ecc,
+    0xffe6, 0x5dd8, 0xe00f, 0xe4c3, 0x9c6a, 0xc4c2, 0x0dd5, 0xf440,
+    0xca16, 0xaa86, 0x3e4a, 0xc6e2, 0x7965, 0x3875, 0xf09c, 0x5f09,
+    0x25d7, 0x7139, 0x1c8f, 0xeeb5, 0x4e79, 0x0d14, 0x7b64, 0x1605,
+    0xeb99, 0xfb04, 0x0a19, 0xf2e3, 0xa681, 0x3937, 0x5422, 0x9163,
+    0x2fd2, 0xa68f, 0x24a5, 0x5c81, 0x2d4d, 0x3aa8, 0x4aa6, 0x5ca0,
+    0x09f3, 0x1779, 0xd5f9, 0xd60f, 0x7ea9, 0x78e6, 0x5330, 0x0c3a,
+    0x3a27, 0x51fc, 0x7ebb, 0x4520, 0xe01d, 0x03a3, 0x7ed6, 0xb69f,
+    0x0296, 0x9ef1, 0x3050, 0x989c, 0xb36a, 0x07b0, 0xdc64, 0x11b1,
+    0xbcdf, 0x2d86, 0x2758, 0x68f8, 0xbdfa, 0x9c39, 0x1a8f, 0xc83e,
+    0xbe16, 0x9845, 0x175a, 0x81ce, 0x98ba, 0x0070, 0xdca0, 0xf48a,
+    0xeb11, 0x5705, 0x3514, 0x704a, 0xa261, 0x2667, 0x262c, 0xde50,
+    0x63fb, 0xae43, 0x0bd8, 0x798e, 0x53b2, 0x008c, 0x3697, 0x2b74,
+    0xf7ef, 0xc56b, 0x9624, 0x1892, 0xe1b8, 0x6b43, 0x2ea4, 0xa15c,
+    0x8af4, 0x04e4, 0x6a29, 0xeb95, 0xce68, 0x890b, 0xb0bd, 0x8d6a,
+    0x8d1c, 0x9994, 0x5c14, 0x3787, 0x73c2, 0x30f2, 0xbb2d, 0x9b41,
+    0xc49f, 0xda75, 0xfc88, 0xfc74, 0x3551, 0xb75d, 0x3ea7, 0x80e2,
+    0x8282, 0xe20e, 0x5b9c, 0x5d04, 0x55db, 0x3e4f, 0xeedd, 0x7562,
+    0xb291, 0x8083, 0x3059, 0x3bab, 0x2221, 0x544b, 0x1671, 0x518f,
+    0x95d7, 0x84f3, 0xef69, 0xc124, 0xccf3, 0x1f08, 0x4bd4, 0x61e1,
+    0x316a, 0xa272, 0xc453, 0x400b, 0x15ca, 0xe93a, 0x78ee, 0x431c,
+    0x7d1d, 0x0872, 0xbec8, 0x2eef, 0x1dbc, 0x416c, 0x1c04, 0x9a8b,
+    0x2fb9, 0x2d80, 0x3ede, 0x63bb, 0x8d40, 0x3a55, 0xcfc1, 0x5d8a,
+    0xc586, 0x437e, 0x6945, 0x4936, 0x3990, 0x366f, 0x77ce, 0xa047,
+    0x9643, 0x45d6, 0x98a3, 0x3c84, 0xacda, 0x8a20, 0xb59b, 0xeec4,
+    0x39e7, 0xf0da, 0xa317, 0xd4f4, 0x511f, 0x2fd6, 0x3072, 0xba9b,
+    0x1135, 0x954a, 0xae11, 0xa0b8, 0xcd9e, 0x37ae, 0x8063, 0xe12e,
+    0x896e, 0xe5d3, 0x8ce2, 0x7681, 0xb3f4, 0xecce, 0xd96f, 0xe897,
+    0xb0dd, 0x318e, 0x9740, 0xbbd4, 0xfa16, 0xc05c, 0x4b9c, 0x2dc3
+};
+
+const uint16_t position_card [64] = {
+    0xf752, 0xc526, 0xdf98, 0x2972, 0xbaf2, 0xd163, 0xc25f, 0x1ba5,
+    0x6335, 0x0756, 0x1487, 0xc22e, 0x2a39, 0xf1e5, 0x1eb6, 0x94b0,
+    0x9fba, 0x6015, 0x1a00, 0x082b, 0x7524, 0xea28, 0x6308, 0x9c63,
+    0x7dc6, 0x8b50, 0x3ca3, 0x121a, 0x1786, 0x2974, 0xc11a, 0x9264,
+    0x49eb, 0x79ef, 0x39cf, 0x0530, 0xe4c3, 0x2268, 0x0014, 0xa1c4,
+    0x273a, 0x3468, 0xaee9, 0xb210, 0x5777, 0x89aa, 0xcc9e, 0x1fe2,
+    0x5b49, 0x0c36, 0x28ea, 0x682b, 0x5ed2, 0x8495, 0xa273, 0xd79a,
+    0xdb57, 0x7dc4, 0x11aa, 0x1e00, 0x1a38, 0x9539, 0xeef8, 0xb42a
+};
+
+
+/*
+ * Hash the board from scratch, and forget the positions seen before.
+ */
+void position_reset (void)
+{
+    position_hash = 0;
+
+    /* Not the held cards: a position is what is on the table between moves */
+    for (uint8_t s = 0; s < 15; s++)
+    {
+        uint8_t d = 0;
+
+        for (uint8_t entry = stack_base [s]; entry != STACK_END; entry = card_next [entry])
+        {
+            POSITION_TOGGLE (s, d++, card_value [entry]);
+        }
+    }
+
+    history_count = 0;
+    history_next = 0;
+    position_remember ();
+}
+
+
+/*
+ * Note the position as it is now.
+ */
+void position_remember (void)
+{
+    history [history_next] = position_hash;
+    history_next = (history_next + 1) % POSITION_HISTORY;
+    if (history_count < POSITION_HISTORY)
+    {
+        history_count++;
+    }
+}
+
+
+/*
+ * True if a position's hash is among the recent ones.
+ */
+bool position_seen (uint16_t hash)
+{
+    for (uint8_t i = 0; i < history_count; i++)
+    {
+        if (history [i] == hash)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
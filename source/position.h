@@ -0,0 +1,21 @@
+/* Recent positions remembered, to spot a return to one */
+#define POSITION_HISTORY    16
+
+/* Zobrist hash of the cards on the table, kept up to date as cards move. */
+extern uint16_t position_hash;
+
+extern const uint16_t position_place [256];
+extern const uint16_t position_card [64];
+
+/* Key of a card at a depth in a stack. Exclusive-or it into a hash to add or remove the card. */
+#define POSITION_KEY(s, depth, card)    (position_place [((s) << 4) | (depth)] + position_card [(card) & 0x3f])
+#define POSITION_TOGGLE(s, depth, card) (position_hash ^= POSITION_KEY (s, depth, card))
+
+/* Hash the board from scratch, and forget the positions seen before. Call once a deal is on the table. */
+void position_reset (void);
+
+/* Note the position as it is now. Call after each move. */
+void position_remember (void);
+
+/* True if a position's hash is among the recent ones. */
+bool position_seen (uint16_t hash);
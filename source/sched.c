@@ -0,0 +1,64 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "SMSlib.h"
+
+#include "sched.h"
+
+/* The V counter reads 0x00-0xbf during active display, and higher during VBlank */
+#define VBLANK_START_LINE   0xc0
+
+uint16_t sched_overruns = 0;
+uint8_t sched_vblank_lines = 0;
+
+
+/*
+ * Run a list of tasks, checking each against its budget.
+ *
+ * Time is measured with the V counter. It skips back six lines part way
+ * through VBlank, so a task that spans the jump may be under-counted.
+ */
+static void sched_run (const task_t *tasks, uint8_t count)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        uint8_t start = SMS_getVCount ();
+
+        tasks [i].run ();
+
+        if ((uint8_t) (SMS_getVCount () - start) > tasks [i].budget)
+        {
+            sched_overruns++;
+        }
+    }
+}
+
+
+/*
+ * Run the tasks that write to the VDP.
+ */
+void sched_run_vblank (const task_t *tasks, uint8_t count)
+{
+    uint8_t start = SMS_getVCount ();
+    uint8_t end;
+
+    sched_run (tasks, count);
+
+    end = SMS_getVCount ();
+    sched_vblank_lines = end - start;
+
+    /* The last write landed after the picture started being drawn */
+    if (end < VBLANK_START_LINE)
+    {
+        sched_overruns++;
+    }
+}
+
+
+/*
+ * Run the tasks that only touch RAM.
+ */
+void sched_run_active (const task_t *tasks, uint8_t count)
+{
+    sched_run (tasks, count);
+}
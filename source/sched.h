@@ -0,0 +1,18 @@
+/* A piece of per-frame work, and the most scanlines (228 cycles each) it should take. */
+typedef struct task_s
+{
+    void (*run) (void);
+    uint8_t budget;
+} task_t;
+
+/* Number of tasks, or VBlank phases, that have run over budget. */
+extern uint16_t sched_overruns;
+
+/* Scanlines taken by the most recent VBlank phase. */
+extern uint8_t sched_vblank_lines;
+
+/* Run the tasks that write to the VDP. Call straight after SMS_waitForVBlank (). */
+void sched_run_vblank (const task_t *tasks, uint8_t count);
+
+/* Run the tasks that only touch RAM, and so may overlap active display. */
+void sched_run_active (const task_t *tasks, uint8_t count);
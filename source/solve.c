@@ -0,0 +1,666 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "SMSlib.h"
+
+#include "hint.h"
+#include "position.h"
+#include "solve.h"
+#include "stack.h"
+
+/*
+ * "Still winnable?" search: a depth-first search of the position on a copy
+ * of the board, a step at a time in whatever each frame leaves spare. The
+ * path is an explicit stack of moves, and each node's moves are listed
+ * again when the search comes back to it, rather than kept.
+ *
+ * A win found means the position is solvable. A search that runs out
+ * without a win, having never stopped at the depth limit or been unable to
+ * remember a position, means a dead end. Anything else is unknown. Positions
+ * are remembered by a pair of 16-bit hashes, so a dead end is very likely
+ * rather than certain.
+ *
+ * The answers for the last few positions are kept by position_hash, so
+ * going back to one, as undoing a move does, needs no search.
+ */
+
+/* Stack indices, as in main.c */
+#define STACK_SLOT_1        8
+#define STACK_SNEP          11
+#define STACK_FOUNDATION_1  12
+#define STACKS              15
+
+#define MOVE_DRAGONS    0xfe
+#define MOVES_MAX       32
+#define SEEN_SIZE       256     /* Must be a power of two */
+#define SEEN_PROBES     8
+#define RESULTS_SIZE    8
+
+/* Random numbers for the stack hashes, by card */
+static const uint16_t zobrist [64] = {
+    0x7567, 0x9459, 0xe0bb, 0x8623, 0x0827, 0x3ecb, 0x484d, 0xaa20,
+    0xf637, 0xa318, 0xaa10, 0x34d2, 0x20dd, 0xc313, 0x5930, 0x46f1,
+    0xe137, 0xbe44, 0x70d5, 0xd1a1, 0x0754, 0x8709, 0xe56c, 0xbc94,
+    0x213f, 0x0f2e, 0xa42a, 0x33b5, 0x9e9c, 0xb505, 0x75ee, 0xd992,
+    0xf644, 0x0d9c, 0x2d32, 0xcadd, 0x9ad0, 0x502e, 0x1d15, 0x401e,
+    0xf731, 0x5336, 0x2512, 0xc804, 0x8357, 0xae48, 0xd526, 0x85fc,
+    0xe21c, 0xf9d0, 0x18fa, 0x684a, 0xe095, 0x0c90, 0xd7b7, 0xd2b1,
+    0x50d5, 0xbb1e, 0xc1a8, 0x55ff, 0x3a21, 0xbcd7, 0x2760, 0x4f69,
+};
+
+uint8_t solve_result = SOLVE_UNKNOWN;
+uint16_t solve_nodes = 0;
+uint8_t solve_lines = 0;
+
+static bool running = false;
+static bool complete;       /* Nothing has been cut short */
+
+static uint8_t board [STACKS] [16];
+static uint8_t height [STACKS];
+static uint16_t hash [STACKS];
+
+/* Each step of the path: the move made, the next move to try, and where stacked dragons came from */
+static uint8_t path_from [SOLVE_DEPTH + 1];
+static uint8_t path_to [SOLVE_DEPTH + 1];
+static uint8_t path_count [SOLVE_DEPTH + 1];
+static uint8_t path_next [SOLVE_DEPTH + 1];
+static uint16_t path_dragons [SOLVE_DEPTH + 1];
+static uint8_t depth;
+
+/* Moves from the position at the end of the path: cards moved, or the dragon kind */
+static uint8_t move_from [MOVES_MAX];
+static uint8_t move_to [MOVES_MAX];
+static uint8_t move_count [MOVES_MAX];
+static uint8_t moves;
+
+/* Columns that take a card, by its colour and value, worked out once per move list */
+static uint8_t takes [3] [9];
+
+static uint16_t seen [SEEN_SIZE];
+static uint16_t seen_check [SEEN_SIZE];
+
+/* Answers for recent positions, oldest overwritten first */
+static uint16_t search_hash;
+static uint16_t result_hash [RESULTS_SIZE];
+static uint8_t result_value [RESULTS_SIZE];
+static uint8_t result_next = 0;
+
+
+/*
+ * Finish the search with an answer, keeping it if it is a definite one.
+ */
+static void finish (uint8_t result)
+{
+    solve_result = result;
+    running = false;
+
+    if (result != SOLVE_UNKNOWN)
+    {
+        result_hash [result_next] = search_hash;
+        result_value [result_next] = result;
+        result_next = (result_next + 1) % RESULTS_SIZE;
+    }
+}
+
+
+/*
+ * Put a card on a stack, keeping its hash.
+ */
+static void push (uint8_t s, uint8_t card)
+{
+    board [s] [height [s]++] = card;
+    hash [s] = ((hash [s] << 3) | (hash [s] >> 13)) ^ zobrist [card & 0x3f];
+}
+
+
+/*
+ * Take the top card off a stack, keeping its hash.
+ */
+static uint8_t pop (uint8_t s)
+{
+    uint8_t card = board [s] [--height [s]];
+    uint16_t h = hash [s] ^ zobrist [card & 0x3f];
+
+    hash [s] = (h >> 3) | (h << 13);
+
+    return card;
+}
+
+
+/*
+ * Move the top (count) cards from one stack to another, in order.
+ */
+static void move_cards (uint8_t from, uint8_t to, uint8_t count)
+{
+    uint8_t run [16];
+
+    for (uint8_t i = count; i-- > 0;)
+    {
+        run [i] = pop (from);
+    }
+    for (uint8_t i = 0; i < count; i++)
+    {
+        push (to, run [i]);
+    }
+}
+
+
+/*
+ * Remember the position. Returns false if it has been seen before.
+ * The columns, and the slots, are each combined in an order-free way, so
+ * positions that only differ by which column is which count as the same.
+ */
+static bool remember (void)
+{
+    uint16_t columns_xor = 0;
+    uint16_t columns_sum = 0;
+    uint16_t slots_xor = 0;
+    uint16_t slots_sum = 0;
+    uint16_t key;
+    uint16_t check;
+    uint8_t index;
+
+    for (uint8_t s = 0; s < STACK_SLOT_1; s++)
+    {
+        columns_xor ^= hash [s];
+        columns_sum += hash [s];
+    }
+    for (uint8_t s = STACK_SLOT_1; s < STACK_SNEP; s++)
+    {
+        slots_xor ^= hash [s];
+        slots_sum += hash [s];
+    }
+
+    /* The foundations hold whatever the rest does not, so need no hash of their own */
+    key = columns_xor ^ ((slots_xor << 8) | (slots_xor >> 8));
+    check = (columns_sum - slots_sum) | 1;
+    index = key & (SEEN_SIZE - 1);
+
+    for (uint8_t probe = 0; probe < SEEN_PROBES; probe++)
+    {
+        if (seen_check [index] == 0)
+        {
+            seen [index] = key;
+            seen_check [index] = check;
+            return true;
+        }
+        if (seen [index] == key && seen_check [index] == check)
+        {
+            return false;
+        }
+        index = (index + 1) & (SEEN_SIZE - 1);
+    }
+
+    /* No room: search it anyway, but it may come round again */
+    complete = false;
+    return true;
+}
+
+
+/*
+ * The foundation that takes a card, or 0xff.
+ */
+static uint8_t foundation_for (uint8_t card)
+{
+    uint8_t empty = 0xff;
+
+    if (card == 0x33)
+    {
+        return STACK_SNEP;
+    }
+    if ((card & 0x30) == 0x30)
+    {
+        return 0xff;
+    }
+
+    for (uint8_t f = STACK_FOUNDATION_1; f < STACKS; f++)
+    {
+        if (height [f] == 0)
+        {
+            if (empty == 0xff)
+            {
+                empty = f;
+            }
+        }
+        else if ((board [f] [0] & 0x30) == (card & 0x30))
+        {
+            return (height [f] == (card & 0x0f)) ? f : 0xff;
+        }
+    }
+
+    return ((card & 0x0f) == 0) ? empty : 0xff;
+}
+
+
+/*
+ * True if sending a card home can never be a mistake: the snep, or a
+ * number that no other colour's cards could still need to be placed on.
+ */
+static bool foundation_safe (uint8_t card)
+{
+    uint8_t value = card & 0x0f;
+    uint8_t others = 0;
+
+    if (card == 0x33)
+    {
+        return true;
+    }
+
+    for (uint8_t f = STACK_FOUNDATION_1; f < STACKS; f++)
+    {
+        if (height [f] > 0 && (board [f] [0] & 0x30) != (card & 0x30) && height [f] >= value)
+        {
+            others++;
+        }
+    }
+
+    return value <= 1 || others == 2;
+}
+
+
+/*
+ * Add a move to the list, if there is room.
+ */
+static void add_move (uint8_t from, uint8_t to, uint8_t count)
+{
+    if (moves < MOVES_MAX)
+    {
+        move_from [moves] = from;
+        move_to [moves] = to;
+        move_count [moves] = count;
+        moves++;
+    }
+}
+
+
+/*
+ * Add a move of (count) cards from a stack to each column in a mask,
+ * lowest first.
+ */
+static void add_moves_to (uint8_t from, uint8_t columns, uint8_t count)
+{
+    for (uint8_t to = 0; columns != 0; to++, columns >>= 1)
+    {
+        if (columns & 1)
+        {
+            add_move (from, to, count);
+        }
+    }
+}
+
+
+/*
+ * The columns a card can go on.
+ */
+static uint8_t columns_taking (uint8_t card)
+{
+    return ((card & 0x30) == 0x30) ? 0 : takes [card >> 4] [card & 0x0f];
+}
+
+
+/*
+ * List the moves worth trying: a move that can't be wrong alone if there
+ * is one, otherwise foundation moves, moves onto cards, moves into a slot,
+ * and moves into the first empty column. Sets moves to their number.
+ *
+ * The columns each card can go on are looked up in takes rather than
+ * searched for, so a listing is one pass over the table: a lookup per card
+ * in a run and at most MOVES_MAX moves.
+ */
+static void list_moves (void)
+{
+    uint8_t empty_column = 0xff;
+    uint8_t empty_slot = 0xff;
+    uint8_t dragons [3] = { 0 };
+
+    moves = 0;
+
+    for (uint8_t s = 0; s < STACK_SNEP; s++)
+    {
+        uint8_t h = height [s];
+        uint8_t top;
+
+        if (h == 0)
+        {
+            if (s < STACK_SLOT_1 && empty_column == 0xff)
+            {
+                empty_column = s;
+            }
+            else if (s >= STACK_SLOT_1 && empty_slot == 0xff)
+            {
+                empty_slot = s;
+            }
+            continue;
+        }
+
+        /* Stacked dragons stay put */
+        if (s >= STACK_SLOT_1 && h > 1)
+        {
+            continue;
+        }
+
+        top = board [s] [h - 1];
+        if (top >= 0x30 && top <= 0x32)
+        {
+            dragons [top & 0x0f]++;
+        }
+    }
+
+    /* A card goes on a column whose top is one higher and another colour; nothing goes on a 1 or a special */
+    for (uint8_t colour = 0; colour < 3; colour++)
+    {
+        for (uint8_t value = 0; value < 9; value++)
+        {
+            takes [colour] [value] = 0;
+        }
+    }
+    for (uint8_t s = 0; s < STACK_SLOT_1; s++)
+    {
+        uint8_t top = (height [s] > 0) ? board [s] [height [s] - 1] : 0x30;
+
+        if ((top & 0x30) != 0x30 && (top & 0x0f) > 0)
+        {
+            for (uint8_t colour = 0; colour < 3; colour++)
+            {
+                if (colour != top >> 4)
+                {
+                    takes [colour] [(top & 0x0f) - 1] |= 1 << s;
+                }
+            }
+        }
+    }
+
+    /* Dragons, and safe foundation moves, are always worth making at once */
+    for (uint8_t kind = 0; kind < 3; kind++)
+    {
+        if (dragons [kind] == 4)
+        {
+            uint8_t to = empty_slot;
+
+            for (uint8_t s = STACK_SLOT_1; s < STACK_SNEP; s++)
+            {
+                if (height [s] == 1 && board [s] [0] == 0x30 + kind)
+                {
+                    to = s;
+                    break;
+                }
+            }
+            if (to != 0xff)
+            {
+                add_move (MOVE_DRAGONS, to, kind);
+                return;
+            }
+        }
+    }
+
+    for (uint8_t s = 0; s < STACK_SNEP; s++)
+    {
+        uint8_t to;
+
+        if (height [s] == 0 || (s >= STACK_SLOT_1 && height [s] > 1))
+        {
+            continue;
+        }
+
+        to = foundation_for (board [s] [height [s] - 1]);
+        if (to != 0xff)
+        {
+            if (foundation_safe (board [s] [height [s] - 1]))
+            {
+                moves = 0;
+                add_move (s, to, 1);
+                return;
+            }
+            add_move (s, to, 1);
+        }
+    }
+
+    /* Runs onto other columns, growing the run downwards while it stays valid */
+    for (uint8_t from = 0; from < STACK_SLOT_1; from++)
+    {
+        uint8_t h = height [from];
+
+        for (uint8_t d = h; d-- > 0;)
+        {
+            uint8_t card = board [from] [d];
+
+            if (d < h - 1)
+            {
+                uint8_t above = board [from] [d + 1];
+
+                if ((card & 0x30) == 0x30 || (above & 0x30) == 0x30 ||
+                    (card & 0x30) == (above & 0x30) || (above & 0x0f) != (card & 0x0f) - 1)
+                {
+                    break;
+                }
+            }
+
+            add_moves_to (from, columns_taking (card) & ~(1 << from), h - d);
+
+            /* A whole column moved to an empty one changes nothing */
+            if (empty_column != 0xff && d > 0)
+            {
+                add_move (from, empty_column, h - d);
+            }
+        }
+    }
+
+    for (uint8_t s = 0; s < STACK_SLOT_1; s++)
+    {
+        if (height [s] > 0 && empty_slot != 0xff)
+        {
+            add_move (s, empty_slot, 1);
+        }
+    }
+
+    for (uint8_t s = STACK_SLOT_1; s < STACK_SNEP; s++)
+    {
+        if (height [s] != 1)
+        {
+            continue;
+        }
+
+        add_moves_to (s, columns_taking (board [s] [0]), 1);
+        if (empty_column != 0xff)
+        {
+            add_move (s, empty_column, 1);
+        }
+    }
+
+    /* A full list may have lost moves */
+    if (moves == MOVES_MAX)
+    {
+        complete = false;
+    }
+}
+
+
+/*
+ * Make the move in a step of the path.
+ */
+static void apply (uint8_t d)
+{
+    if (path_from [d] == MOVE_DRAGONS)
+    {
+        uint8_t dragon = 0x30 + path_count [d];
+
+        path_dragons [d] = 0;
+        for (uint8_t s = 0; s < STACK_SNEP; s++)
+        {
+            if (height [s] > 0 && board [s] [height [s] - 1] == dragon)
+            {
+                pop (s);
+                path_dragons [d] |= 1 << s;
+            }
+        }
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            push (path_to [d], dragon);
+        }
+    }
+    else
+    {
+        move_cards (path_from [d], path_to [d], path_count [d]);
+    }
+}
+
+
+/*
+ * Take back the move in a step of the path.
+ */
+static void undo (uint8_t d)
+{
+    if (path_from [d] == MOVE_DRAGONS)
+    {
+        uint8_t dragon = 0x30 + path_count [d];
+
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            pop (path_to [d]);
+        }
+        for (uint8_t s = 0; s < STACK_SNEP; s++)
+        {
+            if (path_dragons [d] & (1 << s))
+            {
+                push (s, dragon);
+            }
+        }
+    }
+    else
+    {
+        move_cards (path_to [d], path_from [d], path_count [d]);
+    }
+}
+
+
+/*
+ * One step of the search: go down a move, or back up one.
+ */
+static void step (void)
+{
+    uint8_t next;
+    bool won = true;
+
+    for (uint8_t s = 0; s < STACK_SLOT_1; s++)
+    {
+        if (height [s] > 0)
+        {
+            won = false;
+            break;
+        }
+    }
+    if (won)
+    {
+        finish (SOLVE_SOLVABLE);
+        return;
+    }
+
+    moves = 0;
+    if (depth < SOLVE_DEPTH)
+    {
+        list_moves ();
+    }
+    else
+    {
+        complete = false;
+    }
+
+    next = path_next [depth];
+    if (next >= moves)
+    {
+        if (depth == 0)
+        {
+            finish (complete ? SOLVE_DEAD : SOLVE_UNKNOWN);
+            return;
+        }
+
+        undo (--depth);
+        return;
+    }
+
+    path_from [depth] = move_from [next];
+    path_to [depth] = move_to [next];
+    path_count [depth] = move_count [next];
+    path_next [depth] = next + 1;
+    apply (depth);
+    solve_nodes++;
+
+    if (!remember ())
+    {
+        undo (depth);
+        return;
+    }
+
+    path_next [++depth] = 0;
+}
+
+
+/*
+ * Search again from the board as it is now.
+ */
+void solve_restart (void)
+{
+    solve_result = SOLVE_UNKNOWN;
+    solve_nodes = 0;
+    depth = 0;
+    path_next [0] = 0;
+    complete = true;
+
+    /* Still on the hint line: it wins from here */
+    if (hint_from != HINT_NONE)
+    {
+        solve_result = SOLVE_SOLVABLE;
+        running = false;
+        return;
+    }
+
+    /* Answered before */
+    search_hash = position_hash;
+    for (uint8_t i = 0; i < RESULTS_SIZE; i++)
+    {
+        if (result_value [i] != SOLVE_UNKNOWN && result_hash [i] == search_hash)
+        {
+            solve_result = result_value [i];
+            running = false;
+            return;
+        }
+    }
+
+    for (uint8_t s = 0; s < STACKS; s++)
+    {
+        height [s] = 0;
+        hash [s] = 0;
+        for (uint8_t entry = stack_base [s]; entry != STACK_END; entry = card_next [entry])
+        {
+            push (s, card_value [entry]);
+        }
+    }
+
+    for (uint16_t i = 0; i < SEEN_SIZE; i++)
+    {
+        seen_check [i] = 0;
+    }
+    remember ();
+
+    running = true;
+}
+
+
+/*
+ * Frame task: carry on searching until this frame's slice is used. A step
+ * lists moves in one pass over the table and moves at most a run, so the
+ * slice is overrun by at most one such step.
+ */
+void solve_run (void)
+{
+    uint8_t start = SMS_getVCount ();
+    uint8_t lines = 0;
+
+    while (running && lines < SOLVE_SLICE)
+    {
+        step ();
+        lines = SMS_getVCount () - start;
+    }
+
+    solve_lines = lines;
+}
@@ -0,0 +1,24 @@
+/* Scanlines of each frame the search may use. Build with SOLVE_SLICE=n ./build.sh to change it. */
+#ifndef SOLVE_SLICE
+#define SOLVE_SLICE 48
+#endif
+
+/* Most moves the search looks ahead */
+#define SOLVE_DEPTH 48
+
+/* What the search knows about the position, in solve_result */
+#define SOLVE_UNKNOWN   0
+#define SOLVE_SOLVABLE  1
+#define SOLVE_DEAD      2
+
+extern uint8_t solve_result;
+
+/* Positions searched since the last move, and scanlines used in the last frame, for the debug overlay. */
+extern uint16_t solve_nodes;
+extern uint8_t solve_lines;
+
+/* Search again from the board as it is now. Call after each move, with nothing held. */
+void solve_restart (void);
+
+/* Frame task: carry on searching until this frame's slice is used. */
+void solve_run (void);
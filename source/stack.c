@@ -0,0 +1,153 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "position.h"
+#include "stack.h"
+
+/*
+ * Board storage. Each of the 40 cards has an entry, linked to the card on
+ * top of it, and each stack is its bottom and top entries and its height.
+ * Moving a run of cards relinks two entries, however long the run is; only
+ * finding the run's first card means walking up its stack.
+ *
+ * This takes 128 bytes, where a 16 x 16 array of cards took 256.
+ */
+
+/* The held cards, which are not part of the position */
+#define STACK_HELD      15
+
+uint8_t card_value [STACK_CARDS];
+uint8_t card_next [STACK_CARDS];
+
+uint8_t stack_base [STACK_COUNT] = {
+    STACK_END, STACK_END, STACK_END, STACK_END, STACK_END, STACK_END, STACK_END, STACK_END,
+    STACK_END, STACK_END, STACK_END, STACK_END, STACK_END, STACK_END, STACK_END, STACK_END
+};
+uint8_t stack_tail [STACK_COUNT];
+uint8_t stack_height [STACK_COUNT] = { 0 };
+
+/* Entries given out since the table was cleared */
+static uint8_t cards_used = 0;
+
+
+/*
+ * Empty every stack, ready for a new deal.
+ */
+void stack_clear (void)
+{
+    memset (stack_base, STACK_END, sizeof (stack_base));
+    memset (stack_height, 0, sizeof (stack_height));
+    cards_used = 0;
+}
+
+
+/*
+ * Deal a new card onto a stack.
+ */
+void stack_push (uint8_t s, uint8_t card)
+{
+    uint8_t entry = cards_used++;
+
+    card_value [entry] = card;
+    card_next [entry] = STACK_END;
+
+    if (stack_height [s] == 0)
+    {
+        stack_base [s] = entry;
+    }
+    else
+    {
+        card_next [stack_tail [s]] = entry;
+    }
+    stack_tail [s] = entry;
+    stack_height [s]++;
+}
+
+
+/*
+ * The card at a depth in a stack, or 0xff above its top.
+ */
+uint8_t stack_card (uint8_t s, uint8_t depth)
+{
+    uint8_t entry = stack_base [s];
+
+    if (depth >= stack_height [s])
+    {
+        return 0xff;
+    }
+
+    while (depth--)
+    {
+        entry = card_next [entry];
+    }
+
+    return card_value [entry];
+}
+
+
+/*
+ * Move the cards from a depth up onto another stack, in order. Cards on the
+ * table are in the position hash, so the run's keys are swapped over on the
+ * way; the held cards are not.
+ */
+void stack_move (uint8_t from, uint8_t depth, uint8_t to)
+{
+    uint8_t below = STACK_END;
+    uint8_t first = stack_base [from];
+    uint8_t count = stack_height [from] - depth;
+    uint8_t to_depth = stack_height [to];
+
+    for (uint8_t d = 0; d < depth; d++)
+    {
+        below = first;
+        first = card_next [first];
+    }
+
+    for (uint8_t entry = first, d = 0; entry != STACK_END; entry = card_next [entry], d++)
+    {
+        if (from != STACK_HELD)
+        {
+            POSITION_TOGGLE (from, depth + d, card_value [entry]);
+        }
+        if (to != STACK_HELD)
+        {
+            POSITION_TOGGLE (to, to_depth + d, card_value [entry]);
+        }
+    }
+
+    /* Join the run onto the top of its new stack */
+    if (to_depth == 0)
+    {
+        stack_base [to] = first;
+    }
+    else
+    {
+        card_next [stack_tail [to]] = first;
+    }
+    stack_tail [to] = stack_tail [from];
+    stack_height [to] += count;
+
+    /* And end the old stack below it */
+    if (below == STACK_END)
+    {
+        stack_base [from] = STACK_END;
+    }
+    else
+    {
+        card_next [below] = STACK_END;
+    }
+    stack_tail [from] = below;
+    stack_height [from] = depth;
+}
+
+
+/*
+ * Take every card off a stack, and off the table. Their entries are not
+ * given out again until the next deal.
+ */
+void stack_discard (uint8_t s)
+{
+    stack_base [s] = STACK_END;
+    stack_height [s] = 0;
+}
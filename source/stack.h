@@ -0,0 +1,30 @@
+/* The board: the 40 cards, each linked to the card on top of it, and sixteen stacks of them. */
+#define STACK_CARDS     40
+#define STACK_COUNT     16
+#define STACK_END       0xff    /* card_next of a stack's top card, and stack_base of an empty stack */
+
+extern uint8_t card_value [STACK_CARDS];
+extern uint8_t card_next [STACK_CARDS];
+
+/* Each stack's bottom and top card, and how many cards it holds. */
+extern uint8_t stack_base [STACK_COUNT];
+extern uint8_t stack_tail [STACK_COUNT];
+extern uint8_t stack_height [STACK_COUNT];
+
+/* The top card of a stack, or 0xff if it is empty. */
+#define stack_top(s)    ((stack_height [(s)] == 0) ? 0xff : card_value [stack_tail [(s)]])
+
+/* Empty every stack, ready for a new deal. */
+void stack_clear (void);
+
+/* Deal a new card onto a stack. */
+void stack_push (uint8_t s, uint8_t card);
+
+/* The card at a depth in a stack, or 0xff above its top. */
+uint8_t stack_card (uint8_t s, uint8_t depth);
+
+/* Move the cards from a depth up onto another stack, in order, keeping position_hash. */
+void stack_move (uint8_t from, uint8_t depth, uint8_t to);
+
+/* Take every card off a stack, and off the table. */
+void stack_discard (uint8_t s);
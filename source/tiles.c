@@ -0,0 +1,82 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "SMSlib.h"
+
+#include "tiles.h"
+
+/*
+ * Unpacker for the tile patterns, as packed by tools/tiles. Each tile is a
+ * byte of two-bit bitplane encodings, plane 0 in the top bits, followed by
+ * each plane's data:
+ *   00   every row 0x00
+ *   01   every row 0xff
+ *   10   an earlier plane of the tile: its index, bit 7 set to invert it
+ *   11   a mask, row 0 in bit 7, then a byte for each set bit; the other
+ *        rows repeat the row above, or 0x00 for row 0
+ *
+ * A tile is built up in RAM and then written to VRAM on its own, so
+ * unpacking can stop and carry on at any tile.
+ */
+
+static uint8_t tile_buffer [32];
+
+
+/*
+ * Unpack tiles into VRAM.
+ */
+const uint8_t *tiles_unpack (const uint8_t *src, uint16_t tile, uint16_t count)
+{
+    while (count--)
+    {
+        uint8_t ops = *src++;
+
+        for (uint8_t plane = 0; plane < 4; plane++)
+        {
+            uint8_t *out = &tile_buffer [plane];
+            uint8_t value = 0x00;
+            uint8_t arg;
+
+            switch (ops & 0xc0)
+            {
+                case 0x40:
+                    value = 0xff;
+                    /* Fall through */
+                case 0x00:
+                    for (uint8_t row = 0; row < 8; row++)
+                    {
+                        out [row * 4] = value;
+                    }
+                    break;
+
+                case 0x80:
+                    arg = *src++;
+                    value = (arg & 0x80) ? 0xff : 0x00;
+                    for (uint8_t row = 0; row < 8; row++)
+                    {
+                        out [row * 4] = tile_buffer [row * 4 + (arg & 0x03)] ^ value;
+                    }
+                    break;
+
+                default:
+                    arg = *src++;
+                    for (uint8_t row = 0; row < 8; row++)
+                    {
+                        if (arg & 0x80)
+                        {
+                            value = *src++;
+                        }
+                        arg <<= 1;
+                        out [row * 4] = value;
+                    }
+                    break;
+            }
+
+            ops <<= 2;
+        }
+
+        SMS_loadTiles (tile_buffer, tile++, sizeof (tile_buffer));
+    }
+
+    return src;
+}
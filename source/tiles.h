@@ -0,0 +1,2 @@
+/* Unpack (count) tiles packed by tools/tiles into VRAM from tile (tile) on. Returns where the next tile's data starts. */
+const uint8_t *tiles_unpack (const uint8_t *src, uint16_t tile, uint16_t count);
@@ -0,0 +1,265 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "SMSlib.h"
+
+#include "vdp.h"
+
+/*
+ * Name table writes for the rendering hot path.
+ *
+ * The assembly versions write straight to the VDP data port, with one
+ * address setup per row. Writes are kept at least 28 cycles apart, as the
+ * VDP can miss writes closer than 26 cycles during active display.
+ *
+ * Cycle counts below are by instruction count, per row of four tiles:
+ *   SMS_loadTileMapArea ():  ~700 (function call per tile)
+ *   vdp_card_strip ():       ~290
+ *   vdp_column ():           ~350
+ *   vdp_blank_strip ():      ~280
+ *
+ * Build with -DVDP_C_FALLBACK to use SMSlib instead.
+ */
+
+#ifdef VDP_C_FALLBACK
+
+static const uint16_t blank_line [32] = { 0 };
+
+
+/*
+ * Write rows of four tiles down the name table.
+ */
+void vdp_card_strip (uint8_t x, uint8_t y, const uint16_t *tiles, uint8_t rows)
+{
+    SMS_loadTileMapArea (x, y, tiles, 4, rows);
+}
+
+
+/*
+ * Fill an area of the name table with tile zero.
+ */
+void vdp_blank_strip (uint8_t x, uint8_t y, uint8_t width, uint8_t rows)
+{
+    for (uint8_t row = 0; row < rows; row++)
+    {
+        SMS_loadTileMapArea (x, y + row, blank_line, width, 1);
+    }
+}
+
+
+/*
+ * Write rows of four tiles down the name table, each from its own pointer.
+ */
+void vdp_column (uint8_t x, uint8_t y, const uint16_t * const *rows, uint8_t count)
+{
+    for (uint8_t row = 0; row < count; row++)
+    {
+        SMS_loadTileMapArea (x, y + row, rows [row], 4, 1);
+    }
+}
+
+#else
+
+/* Arguments for the assembly routines, so they don't depend on SDCC's calling convention */
+static uint16_t strip_addr;
+static const uint16_t *strip_src;
+static const uint16_t * const *strip_list;
+static uint8_t strip_width;
+static uint8_t strip_rows;
+
+
+/*
+ * Stream (strip_rows) rows of four tiles from (strip_src) to (strip_addr).
+ * B counts down one per byte, so the last OUTI of the last row sets Z.
+ */
+static void card_strip_asm (void) __naked
+{
+    __asm
+        ld      hl, (_strip_src)
+        ld      de, (_strip_addr)
+        ld      a, (_strip_rows)
+        add     a, a
+        add     a, a
+        add     a, a
+        ld      b, a
+        ld      c, #0xbe
+
+    1$:
+        ; Set the VRAM address, without the frame interrupt reading the status port in between
+        di
+        ld      a, e
+        out     (0xbf), a
+        ld      a, d
+        out     (0xbf), a
+        ei
+
+        .rept   8
+        outi
+        nop
+        nop
+        nop
+        .endm
+
+        ret     z
+
+        ; Next name table row is 64 bytes on
+        ld      a, e
+        add     a, #64
+        ld      e, a
+        jr      nc, 1$
+        inc     d
+        jr      1$
+    __endasm;
+}
+
+
+/*
+ * Fill (strip_rows) rows of (strip_width) tiles at (strip_addr) with tile zero.
+ */
+static void blank_strip_asm (void) __naked
+{
+    __asm
+        ld      de, (_strip_addr)
+        ld      a, (_strip_rows)
+        ld      h, a
+        ld      c, #0xbe
+
+    1$:
+        di
+        ld      a, e
+        out     (0xbf), a
+        ld      a, d
+        out     (0xbf), a
+        ei
+
+        ld      a, (_strip_width)
+        ld      b, a
+        xor     a
+    2$:
+        out     (c), a
+        nop
+        nop
+        nop
+        nop
+        out     (c), a
+        nop
+        djnz    2$
+
+        dec     h
+        ret     z
+
+        ld      a, e
+        add     a, #64
+        ld      e, a
+        jr      nc, 1$
+        inc     d
+        jr      1$
+    __endasm;
+}
+
+
+/*
+ * Stream (strip_rows) rows of four tiles to (strip_addr), taking each row
+ * from the next pointer in (strip_list).
+ */
+static void column_asm (void) __naked
+{
+    __asm
+        ld      de, (_strip_addr)
+        ld      hl, (_strip_list)
+        ld      c, #0xbe
+
+    1$:
+        di
+        ld      a, e
+        out     (0xbf), a
+        ld      a, d
+        out     (0xbf), a
+        ei
+
+        ; Follow the next row pointer
+        ld      a, (hl)
+        inc     hl
+        push    hl
+        ld      h, (hl)
+        ld      l, a
+
+        .rept   8
+        outi
+        nop
+        nop
+        nop
+        .endm
+
+        pop     hl
+        inc     hl
+
+        ld      a, (_strip_rows)
+        dec     a
+        ret     z
+        ld      (_strip_rows), a
+
+        ; Next name table row is 64 bytes on
+        ld      a, e
+        add     a, #64
+        ld      e, a
+        jr      nc, 1$
+        inc     d
+        jr      1$
+    __endasm;
+}
+
+
+/*
+ * Write rows of four tiles down the name table.
+ */
+void vdp_card_strip (uint8_t x, uint8_t y, const uint16_t *tiles, uint8_t rows)
+{
+    if (rows == 0)
+    {
+        return;
+    }
+
+    strip_addr = XYtoADDR (x, y);
+    strip_src = tiles;
+    strip_rows = rows;
+
+    card_strip_asm ();
+}
+
+
+/*
+ * Fill an area of the name table with tile zero.
+ */
+void vdp_blank_strip (uint8_t x, uint8_t y, uint8_t width, uint8_t rows)
+{
+    if (rows == 0 || width == 0)
+    {
+        return;
+    }
+
+    strip_addr = XYtoADDR (x, y);
+    strip_width = width;
+    strip_rows = rows;
+
+    blank_strip_asm ();
+}
+
+/*
+ * Write rows of four tiles down the name table, each from its own pointer.
+ */
+void vdp_column (uint8_t x, uint8_t y, const uint16_t * const *rows, uint8_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    strip_addr = XYtoADDR (x, y);
+    strip_list = rows;
+    strip_rows = count;
+
+    column_asm ();
+}
+
+#endif
@@ -0,0 +1,8 @@
+/* Write rows of four tiles down the name table, starting at tile (x, y). */
+void vdp_card_strip (uint8_t x, uint8_t y, const uint16_t *tiles, uint8_t rows);
+
+/* Fill an area of the name table, starting at tile (x, y), with tile zero. */
+void vdp_blank_strip (uint8_t x, uint8_t y, uint8_t width, uint8_t rows);
+
+/* Write rows of four tiles down the name table, starting at tile (x, y), taking each row from its own pointer. */
+void vdp_column (uint8_t x, uint8_t y, const uint16_t * const *rows, uint8_t count);
@@ -0,0 +1,498 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "deal.h"
+#include "board.h"
+
+/* Key fields that aren't cards */
+#define KEY_END_OF_COLUMN   0x3f
+#define KEY_EMPTY_SLOT      0x3f
+#define KEY_LOCKED_SLOT     0x38
+
+#define IS_SPECIAL(card)    (((card) & CARD_TYPE_MASK) == 0x30)
+
+
+/*
+ * Height of a stack.
+ */
+uint8_t board_height (const board_t *board, uint8_t s)
+{
+    uint8_t height = 0;
+
+    while (height < STACK_DEPTH && board->stack [s] [height] != NO_CARD)
+    {
+        height++;
+    }
+
+    return height;
+}
+
+
+/*
+ * True once every tableau column is empty, as in the cartridge's win check.
+ */
+bool board_won (const board_t *board)
+{
+    for (uint8_t col = 0; col < 8; col++)
+    {
+        if (board->stack [col] [0] != NO_CARD)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ * Check if the cards from (depth) to the top of a column may be picked up
+ * together, as cursor_pick () does.
+ */
+static bool run_valid (const board_t *board, uint8_t col, uint8_t depth, uint8_t height)
+{
+    for (uint8_t i = depth; i < height; i++)
+    {
+        uint8_t card = board->stack [col] [i];
+
+        /* Special cards cannot be stacked */
+        if (height - depth > 1 && IS_SPECIAL (card))
+        {
+            return false;
+        }
+
+        if (i > depth)
+        {
+            uint8_t previous = board->stack [col] [i - 1];
+
+            if ((card & CARD_TYPE_MASK) == (previous & CARD_TYPE_MASK) ||
+                (card & CARD_VALUE_MASK) != (previous & CARD_VALUE_MASK) - 1)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ * Check if a card may be placed on a column, as cursor_place () does.
+ */
+static bool column_accepts (const board_t *board, uint8_t col, uint8_t height, uint8_t card)
+{
+    uint8_t top;
+
+    if (height == 0)
+    {
+        return true;
+    }
+
+    top = board->stack [col] [height - 1];
+
+    return !IS_SPECIAL (top) && !IS_SPECIAL (card) &&
+           (top & CARD_TYPE_MASK) != (card & CARD_TYPE_MASK) &&
+           (top & CARD_VALUE_MASK) == (card & CARD_VALUE_MASK) + 1;
+}
+
+
+/*
+ * Find the foundation that a single card may be placed on, or NO_CARD.
+ */
+static uint8_t foundation_for (const board_t *board, uint8_t card)
+{
+    uint8_t empty = NO_CARD;
+
+    if (card == CARD_SNEP)
+    {
+        return STACK_SNEP;
+    }
+
+    if (IS_SPECIAL (card))
+    {
+        return NO_CARD;
+    }
+
+    for (uint8_t s = STACK_FOUNDATION_1; s < STACK_FOUNDATION_1 + 3; s++)
+    {
+        uint8_t height = board_height (board, s);
+
+        if (height == 0)
+        {
+            if (empty == NO_CARD)
+            {
+                empty = s;
+            }
+        }
+        else
+        {
+            uint8_t top = board->stack [s] [height - 1];
+
+            if ((top & CARD_TYPE_MASK) == (card & CARD_TYPE_MASK) &&
+                (top & CARD_VALUE_MASK) == (card & CARD_VALUE_MASK) - 1)
+            {
+                return s;
+            }
+        }
+    }
+
+    /* Only a '1' can be placed on an empty foundation */
+    return ((card & CARD_VALUE_MASK) == 0) ? empty : NO_CARD;
+}
+
+
+/*
+ * Find the slot that a kind of dragon can be stacked into, as check_dragons ()
+ * and stack_dragons () do. Returns NO_CARD if the button would be unlit.
+ */
+static uint8_t dragon_slot (const board_t *board, uint8_t kind)
+{
+    uint8_t dragon = 0x30 + kind;
+    uint8_t count = 0;
+    uint8_t slot = NO_CARD;
+
+    for (uint8_t s = 0; s < STACK_SNEP; s++)
+    {
+        uint8_t height = board_height (board, s);
+
+        if (height > 0 && board->stack [s] [height - 1] == dragon)
+        {
+            count++;
+        }
+    }
+
+    if (count != 4)
+    {
+        return NO_CARD;
+    }
+
+    /* A slot holding one of the dragons, otherwise the first empty slot */
+    for (uint8_t s = STACK_SLOT_1; s < STACK_SLOT_1 + 3; s++)
+    {
+        if (board->stack [s] [0] == dragon)
+        {
+            return s;
+        }
+        if (board->stack [s] [0] == NO_CARD && slot == NO_CARD)
+        {
+            slot = s;
+        }
+    }
+
+    return slot;
+}
+
+
+/*
+ * List the legal moves. Foundation moves and dragon stacks come first, as
+ * they are the likeliest to lead to a win. Moves between dragon slots, and
+ * moves off the foundations, are never useful and are not listed.
+ */
+uint8_t board_moves (const board_t *board, move_t *moves)
+{
+    uint8_t height [STACK_COUNT];
+    uint8_t count = 0;
+    uint8_t empty_slot = NO_CARD;
+
+    for (uint8_t s = 0; s < STACK_COUNT; s++)
+    {
+        height [s] = board_height (board, s);
+    }
+
+    for (uint8_t s = STACK_SLOT_1; s < STACK_SLOT_1 + 3; s++)
+    {
+        if (height [s] == 0)
+        {
+            empty_slot = s;
+            break;
+        }
+    }
+
+    /* Dragon stacks */
+    for (uint8_t kind = 0; kind < 3; kind++)
+    {
+        uint8_t slot = dragon_slot (board, kind);
+
+        if (slot != NO_CARD)
+        {
+            moves [count++] = (move_t) { MOVE_DRAGONS, slot, kind };
+        }
+    }
+
+    /* Top cards to the foundations, from the columns and loose cards in the slots */
+    for (uint8_t s = 0; s < STACK_SNEP; s++)
+    {
+        uint8_t to;
+
+        if (height [s] == 0 || (s >= STACK_SLOT_1 && height [s] != 1))
+        {
+            continue;
+        }
+
+        to = foundation_for (board, board->stack [s] [height [s] - 1]);
+        if (to != NO_CARD)
+        {
+            moves [count++] = (move_t) { s, to, 1 };
+        }
+    }
+
+    /* Runs between columns */
+    for (uint8_t from = 0; from < 8; from++)
+    {
+        for (uint8_t depth = height [from]; depth-- > 0;)
+        {
+            if (!run_valid (board, from, depth, height [from]))
+            {
+                break;
+            }
+
+            for (uint8_t to = 0; to < 8; to++)
+            {
+                if (to != from && column_accepts (board, to, height [to], board->stack [from] [depth]))
+                {
+                    moves [count++] = (move_t) { from, to, height [from] - depth };
+                }
+            }
+        }
+    }
+
+    /* Top cards into an empty slot. All empty slots are alike, so only offer one. */
+    for (uint8_t from = 0; from < 8 && empty_slot != NO_CARD; from++)
+    {
+        if (height [from] > 0)
+        {
+            moves [count++] = (move_t) { from, empty_slot, 1 };
+        }
+    }
+
+    /* Loose cards out of the slots */
+    for (uint8_t from = STACK_SLOT_1; from < STACK_SLOT_1 + 3; from++)
+    {
+        if (height [from] != 1)
+        {
+            continue;
+        }
+
+        for (uint8_t to = 0; to < 8; to++)
+        {
+            if (column_accepts (board, to, height [to], board->stack [from] [0]))
+            {
+                moves [count++] = (move_t) { from, to, 1 };
+            }
+        }
+    }
+
+    return count;
+}
+
+
+/*
+ * Make a move in place.
+ */
+void board_apply (board_t *board, const move_t *move)
+{
+    if (move->from == MOVE_DRAGONS)
+    {
+        uint8_t dragon = 0x30 + move->count;
+
+        for (uint8_t s = 0; s < STACK_SNEP; s++)
+        {
+            uint8_t height = board_height (board, s);
+
+            if (height > 0 && board->stack [s] [height - 1] == dragon)
+            {
+                board->stack [s] [height - 1] = NO_CARD;
+            }
+        }
+
+        memset (board->stack [move->to], dragon, 4);
+    }
+    else
+    {
+        uint8_t from_height = board_height (board, move->from);
+        uint8_t to_height = board_height (board, move->to);
+        uint8_t start = from_height - move->count;
+
+        memcpy (&board->stack [move->to] [to_height], &board->stack [move->from] [start], move->count);
+        memset (&board->stack [move->from] [start], NO_CARD, move->count);
+    }
+}
+
+
+/*
+ * Order two columns for the canonical key.
+ */
+static int column_compare (const uint8_t *a, const uint8_t *b)
+{
+    for (uint8_t i = 0; i < STACK_DEPTH; i++)
+    {
+        if (a [i] != b [i])
+        {
+            return (a [i] == NO_CARD) ? 1 : (b [i] == NO_CARD) ? -1 : a [i] - b [i];
+        }
+        if (a [i] == NO_CARD)
+        {
+            break;
+        }
+    }
+
+    return 0;
+}
+
+
+/*
+ * Append a six-bit field to a key.
+ */
+static void key_push (packed_t *key, uint16_t *bit, uint8_t field)
+{
+    uint8_t word = *bit >> 6;
+    uint8_t shift = *bit & 63;
+
+    key->word [word] |= (uint64_t) field << shift;
+    if (shift > 58)
+    {
+        key->word [word + 1] |= (uint64_t) field >> (64 - shift);
+    }
+
+    *bit += 6;
+}
+
+
+/*
+ * Pack the board into its canonical key.
+ *
+ * The tableau columns can be put in any order, as can the dragon slots,
+ * without changing the game, so both are sorted. The foundations are left
+ * out: the cards on them are exactly the ones missing from everywhere else.
+ * At most 40 cards, 8 column ends and 3 slots fit in 306 bits.
+ */
+void board_key (const board_t *board, packed_t *key)
+{
+    const uint8_t *column [8];
+    uint8_t slot [3];
+    uint16_t bit = 0;
+
+    /* Insertion sort, as there are only eight */
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        uint8_t j = i;
+
+        while (j > 0 && column_compare (column [j - 1], board->stack [i]) > 0)
+        {
+            column [j] = column [j - 1];
+            j--;
+        }
+        column [j] = board->stack [i];
+    }
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        const uint8_t *s = board->stack [STACK_SLOT_1 + i];
+        uint8_t j = i;
+        uint8_t field;
+
+        if (s [0] == NO_CARD)
+        {
+            field = KEY_EMPTY_SLOT;
+        }
+        else if (s [1] != NO_CARD)
+        {
+            field = KEY_LOCKED_SLOT | (s [0] & CARD_VALUE_MASK);
+        }
+        else
+        {
+            field = s [0];
+        }
+
+        while (j > 0 && slot [j - 1] > field)
+        {
+            slot [j] = slot [j - 1];
+            j--;
+        }
+        slot [j] = field;
+    }
+
+    memset (key, 0, sizeof (*key));
+
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        for (uint8_t depth = 0; column [i] [depth] != NO_CARD; depth++)
+        {
+            key_push (key, &bit, column [i] [depth]);
+        }
+        key_push (key, &bit, KEY_END_OF_COLUMN);
+    }
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        key_push (key, &bit, slot [i]);
+    }
+}
+
+
+/*
+ * Hash a key, mixing one 64-bit word at a time.
+ */
+uint64_t key_hash (const packed_t *key)
+{
+    uint64_t hash = 0;
+
+    for (uint8_t i = 0; i < 5; i++)
+    {
+        hash = (hash ^ key->word [i]) * 0x9e3779b97f4a7c15;
+        hash ^= hash >> 29;
+    }
+
+    return hash;
+}
+
+
+/*
+ * Describe a move.
+ */
+const char *move_name (const move_t *move)
+{
+    static char name [48];
+    static const char *kinds [3] = { "claw", "paw", "hoof" };
+
+    if (move->from == MOVE_DRAGONS)
+    {
+        snprintf (name, sizeof (name), "stack %s dragons -> slot %d", kinds [move->count], move->to - STACK_SLOT_1 + 1);
+    }
+    else
+    {
+        char from [16];
+        char to [16];
+        uint8_t stacks [2] = { move->from, move->to };
+        char *names [2] = { from, to };
+
+        for (uint8_t i = 0; i < 2; i++)
+        {
+            uint8_t s = stacks [i];
+
+            if (s < STACK_SLOT_1)
+            {
+                snprintf (names [i], 16, "column %d", s + 1);
+            }
+            else if (s < STACK_SNEP)
+            {
+                snprintf (names [i], 16, "slot %d", s - STACK_SLOT_1 + 1);
+            }
+            else if (s == STACK_SNEP)
+            {
+                snprintf (names [i], 16, "snep");
+            }
+            else
+            {
+                snprintf (names [i], 16, "foundation %d", s - STACK_FOUNDATION_1 + 1);
+            }
+        }
+
+        snprintf (name, sizeof (name), "%s -> %s (%d)", from, to, move->count);
+    }
+
+    return name;
+}
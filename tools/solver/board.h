@@ -0,0 +1,38 @@
+/* A move of (count) cards between stacks, or a dragon stack of kind (count) into slot (to). */
+typedef struct move_s
+{
+    uint8_t from;
+    uint8_t to;
+    uint8_t count;
+    uint16_t dragons_from;  /* Set by state_apply (): where the dragons were, for undo */
+} move_t;
+
+#define MOVE_DRAGONS    0xfe
+#define MOVES_MAX       128
+
+/* Canonical packed board: columns and dragon slots sorted, six bits per card. */
+typedef struct packed_s
+{
+    uint64_t word [5];
+} packed_t;
+
+/* Height of a stack. */
+uint8_t board_height (const board_t *board, uint8_t s);
+
+/* True once every tableau column is empty. */
+bool board_won (const board_t *board);
+
+/* List the legal moves, foundation moves first. Returns the number of moves. */
+uint8_t board_moves (const board_t *board, move_t *moves);
+
+/* Make a move in place. */
+void board_apply (board_t *board, const move_t *move);
+
+/* Pack the board into its canonical key. */
+void board_key (const board_t *board, packed_t *key);
+
+/* Hash a key. */
+uint64_t key_hash (const packed_t *key);
+
+/* Describe a move, such as "column 3 -> column 5 (2 cards)". */
+const char *move_name (const move_t *move);
@@ -0,0 +1,15 @@
+#!/bin/sh
+echo ""
+echo "Shenzhen Solitaire Solver Build Script"
+echo "-------------------------------"
+
+cd "$(dirname "$0")" || exit 1
+
+mkdir -p build
+
+echo ""
+echo "Compiling..."
+gcc -std=gnu11 -O2 -Wall -pthread -o build/solver *.c -lm || exit 1
+
+echo ""
+echo "Done"
@@ -0,0 +1,74 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "deal.h"
+
+/* The deck before shuffling */
+static const uint8_t deck_sorted [40] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x30, 0x30, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x32,
+    0x32, 0x32, 0x32, 0x33
+};
+
+/*
+ * SDCC's rand () and srand () (device/lib/rand.c), a 32-bit xorshift.
+ * int is 16 bits on the Z80 and RAND_MAX is 32767.
+ */
+static uint32_t rand_state = 0x80000001;
+
+static void sdcc_srand (uint16_t seed)
+{
+    rand_state = seed | 0x80000000;
+}
+
+static int16_t sdcc_rand (void)
+{
+    uint32_t t = rand_state;
+
+    t ^= t >> 10;
+    t ^= t << 9;
+    t ^= t >> 25;
+
+    rand_state = t;
+
+    return t & 0x7fff;
+}
+
+
+/*
+ * Deal the board that the cartridge deals after srand (seed),
+ * starting from the sorted deck.
+ */
+void deal (board_t *board, uint16_t seed)
+{
+    uint8_t deck [40];
+    uint8_t i;
+
+    memcpy (deck, deck_sorted, sizeof (deck));
+    memset (board, NO_CARD, sizeof (*board));
+
+    sdcc_srand (seed);
+
+    /* Shuffle the deck, as deal () in main.c */
+    for (i = 39; i >= 1; i--)
+    {
+        uint8_t temp = deck [i];
+        uint8_t swap_i = sdcc_rand () % (i + 1);
+
+        deck [i] = deck [swap_i];
+        deck [swap_i] = temp;
+    }
+
+    /* Place the cards */
+    i = 0;
+    for (uint8_t depth = 0; depth < 5; depth++)
+    {
+        for (uint8_t col = 0; col < 8; col++)
+        {
+            board->stack [col] [depth] = deck [i++];
+        }
+    }
+}
@@ -0,0 +1,25 @@
+/* Card bits, as on the cartridge:
+ *   [4:5] Card type (0:black, 1:red, 2:green, 3:special)
+ *   [0:3] Card value (0-8: numbers 1-9, 0-2: dragons, 3: snep)
+ */
+#define CARD_TYPE_MASK      0x30
+#define CARD_VALUE_MASK     0x0f
+#define CARD_SNEP           0x33
+#define NO_CARD             0xff
+
+/* Stack indices, as on the cartridge */
+#define STACK_COLUMN_1      0
+#define STACK_SLOT_1        8
+#define STACK_SNEP          11
+#define STACK_FOUNDATION_1  12
+#define STACK_COUNT         15
+#define STACK_DEPTH         16
+
+/* A board laid out like the cartridge's stack [16] [16], with NO_CARD after the top card */
+typedef struct board_s
+{
+    uint8_t stack [16] [STACK_DEPTH];
+} board_t;
+
+/* Deal the board that the cartridge deals after srand (seed). */
+void deal (board_t *board, uint16_t seed);
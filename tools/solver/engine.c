@@ -0,0 +1,636 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "deal.h"
+#include "board.h"
+#include "engine.h"
+
+#define IS_SPECIAL(card)    (((card) & CARD_TYPE_MASK) == 0x30)
+#define COLOUR(card)        ((card) >> 4)
+#define VALUE(card)         ((card) & CARD_VALUE_MASK)
+
+/*
+ * Zobrist hashing, kept symmetric like the packed key: each column hashes
+ * its cards by depth, and the columns are then summed after mixing, so the
+ * order of the columns doesn't matter. The dragon slots are summed too.
+ * The foundations need no hash, as their cards are the ones missing.
+ */
+static uint64_t zobrist_column [STACK_DEPTH] [64];
+static uint64_t zobrist_slot [64];
+
+
+static uint64_t splitmix (uint64_t *x)
+{
+    uint64_t z = (*x += 0x9e3779b97f4a7c15);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+
+    return z ^ (z >> 31);
+}
+
+
+/*
+ * Mix a column hash before it is summed, so that the sum of columns
+ * doesn't collide more than the columns themselves do.
+ */
+static inline uint64_t column_mix (uint64_t h)
+{
+    return h ? (h ^ (h >> 29)) * 0xbf58476d1ce4e5b9 : 0;
+}
+
+
+/*
+ * Fill in the random numbers behind the hash.
+ */
+void engine_init (void)
+{
+    uint64_t seed = 0x5eed;
+
+    for (uint8_t depth = 0; depth < STACK_DEPTH; depth++)
+    {
+        for (uint8_t card = 0; card < 64; card++)
+        {
+            zobrist_column [depth] [card] = splitmix (&seed);
+        }
+    }
+
+    for (uint8_t field = 0; field < 64; field++)
+    {
+        zobrist_slot [field] = splitmix (&seed);
+    }
+}
+
+
+/*
+ * Add and remove cards, keeping the hash up to date.
+ */
+static inline void column_push (state_t *state, uint8_t col, uint8_t card)
+{
+    uint64_t old = state->column_hash [col];
+    uint8_t depth = state->height [col]++;
+
+    state->column [col] [depth] = card;
+    state->column_hash [col] ^= zobrist_column [depth] [card];
+    state->hash += column_mix (state->column_hash [col]) - column_mix (old);
+}
+
+static inline uint8_t column_pop (state_t *state, uint8_t col)
+{
+    uint64_t old = state->column_hash [col];
+    uint8_t depth = --state->height [col];
+    uint8_t card = state->column [col] [depth];
+
+    state->column_hash [col] ^= zobrist_column [depth] [card];
+    state->hash += column_mix (state->column_hash [col]) - column_mix (old);
+
+    return card;
+}
+
+static inline void slot_set (state_t *state, uint8_t slot, uint8_t field)
+{
+    state->hash += zobrist_slot [field] - zobrist_slot [state->slot [slot]];
+    state->slot [slot] = field;
+}
+
+
+/*
+ * Set up a state from a dealt board.
+ */
+void state_from_board (state_t *state, const board_t *board)
+{
+    memset (state, 0, sizeof (*state));
+
+    for (uint8_t col = 0; col < 8; col++)
+    {
+        for (uint8_t depth = 0; board->stack [col] [depth] != NO_CARD; depth++)
+        {
+            column_push (state, col, board->stack [col] [depth]);
+        }
+    }
+
+    for (uint8_t s = 0; s < 3; s++)
+    {
+        const uint8_t *slot = board->stack [STACK_SLOT_1 + s];
+
+        state->slot [s] = SLOT_EMPTY;
+        state->hash += zobrist_slot [SLOT_EMPTY];
+
+        if (slot [0] != NO_CARD)
+        {
+            slot_set (state, s, (slot [1] != NO_CARD) ? SLOT_LOCKED | VALUE (slot [0]) : slot [0]);
+        }
+    }
+
+    for (uint8_t s = STACK_FOUNDATION_1; s < STACK_FOUNDATION_1 + 3; s++)
+    {
+        uint8_t height = board_height (board, s);
+
+        if (height > 0)
+        {
+            state->foundation [COLOUR (board->stack [s] [0])] = height;
+        }
+    }
+
+    state->snep = (board->stack [STACK_SNEP] [0] == CARD_SNEP);
+}
+
+
+/*
+ * True once every tableau column is empty.
+ */
+bool state_won (const state_t *state)
+{
+    for (uint8_t col = 0; col < 8; col++)
+    {
+        if (state->height [col] != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ * The foundation a card can go to, or NO_CARD.
+ */
+static inline uint8_t foundation_for (const state_t *state, uint8_t card)
+{
+    if (card == CARD_SNEP)
+    {
+        return STACK_SNEP;
+    }
+
+    if (!IS_SPECIAL (card) && VALUE (card) == state->foundation [COLOUR (card)])
+    {
+        return STACK_FOUNDATION_1 + COLOUR (card);
+    }
+
+    return NO_CARD;
+}
+
+
+/*
+ * Check if a card may be placed on a column.
+ */
+static inline bool column_accepts (const state_t *state, uint8_t col, uint8_t card)
+{
+    uint8_t top;
+
+    if (state->height [col] == 0)
+    {
+        return true;
+    }
+
+    top = state->column [col] [state->height [col] - 1];
+
+    return !IS_SPECIAL (top) && !IS_SPECIAL (card) &&
+           COLOUR (top) != COLOUR (card) && VALUE (top) == VALUE (card) + 1;
+}
+
+
+/*
+ * List the legal moves, in the same order as board_moves ().
+ */
+uint8_t state_moves (const state_t *state, move_t *moves)
+{
+    uint8_t count = 0;
+    uint8_t empty_slot = NO_CARD;
+    uint8_t dragons [3] = { 0 };
+
+    for (uint8_t s = 0; s < 3; s++)
+    {
+        if (state->slot [s] == SLOT_EMPTY)
+        {
+            empty_slot = STACK_SLOT_1 + s;
+            break;
+        }
+    }
+
+    /* Dragon stacks: all four on top somewhere, and a slot to go to */
+    for (uint8_t col = 0; col < 8; col++)
+    {
+        uint8_t height = state->height [col];
+
+        if (height > 0)
+        {
+            uint8_t top = state->column [col] [height - 1];
+
+            if (IS_SPECIAL (top) && top != CARD_SNEP)
+            {
+                dragons [VALUE (top)]++;
+            }
+        }
+    }
+    for (uint8_t s = 0; s < 3; s++)
+    {
+        uint8_t card = state->slot [s];
+
+        if (card < SLOT_LOCKED && IS_SPECIAL (card) && card != CARD_SNEP)
+        {
+            dragons [VALUE (card)]++;
+        }
+    }
+    for (uint8_t kind = 0; kind < 3; kind++)
+    {
+        uint8_t to = empty_slot;
+
+        if (dragons [kind] != 4)
+        {
+            continue;
+        }
+
+        for (uint8_t s = 0; s < 3; s++)
+        {
+            if (state->slot [s] == 0x30 + kind)
+            {
+                to = STACK_SLOT_1 + s;
+                break;
+            }
+        }
+
+        if (to != NO_CARD)
+        {
+            moves [count++] = (move_t) { MOVE_DRAGONS, to, kind };
+        }
+    }
+
+    /* Top cards to the foundations */
+    for (uint8_t col = 0; col < 8; col++)
+    {
+        if (state->height [col] > 0)
+        {
+            uint8_t to = foundation_for (state, state->column [col] [state->height [col] - 1]);
+
+            if (to != NO_CARD)
+            {
+                moves [count++] = (move_t) { col, to, 1 };
+            }
+        }
+    }
+    for (uint8_t s = 0; s < 3; s++)
+    {
+        if (state->slot [s] < SLOT_LOCKED)
+        {
+            uint8_t to = foundation_for (state, state->slot [s]);
+
+            if (to != NO_CARD)
+            {
+                moves [count++] = (move_t) { STACK_SLOT_1 + s, to, 1 };
+            }
+        }
+    }
+
+    /* Runs between columns, growing the run downwards while it stays valid */
+    for (uint8_t from = 0; from < 8; from++)
+    {
+        const uint8_t *column = state->column [from];
+        uint8_t height = state->height [from];
+
+        for (uint8_t depth = height; depth-- > 0;)
+        {
+            uint8_t card = column [depth];
+
+            if (depth < height - 1)
+            {
+                uint8_t above = column [depth + 1];
+
+                if (IS_SPECIAL (card) || IS_SPECIAL (above) ||
+                    COLOUR (card) == COLOUR (above) || VALUE (above) != VALUE (card) - 1)
+                {
+                    break;
+                }
+            }
+
+            for (uint8_t to = 0; to < 8; to++)
+            {
+                if (to != from && column_accepts (state, to, card))
+                {
+                    moves [count++] = (move_t) { from, to, height - depth };
+                }
+            }
+        }
+    }
+
+    /* Top cards into an empty slot */
+    for (uint8_t from = 0; from < 8 && empty_slot != NO_CARD; from++)
+    {
+        if (state->height [from] > 0)
+        {
+            moves [count++] = (move_t) { from, empty_slot, 1 };
+        }
+    }
+
+    /* Loose cards out of the slots */
+    for (uint8_t s = 0; s < 3; s++)
+    {
+        if (state->slot [s] >= SLOT_LOCKED)
+        {
+            continue;
+        }
+
+        for (uint8_t to = 0; to < 8; to++)
+        {
+            if (column_accepts (state, to, state->slot [s]))
+            {
+                moves [count++] = (move_t) { STACK_SLOT_1 + s, to, 1 };
+            }
+        }
+    }
+
+    return count;
+}
+
+
+/*
+ * Check if sending a card home can never be a mistake: it is the snep card,
+ * or a number that no card still out could be placed on, as every lower
+ * card of another colour is already home.
+ */
+static inline bool foundation_safe (const state_t *state, uint8_t card)
+{
+    if (card == CARD_SNEP)
+    {
+        return true;
+    }
+
+    for (uint8_t colour = 0; colour < 3; colour++)
+    {
+        if (colour != COLOUR (card) && state->foundation [colour] < VALUE (card))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ * List the moves worth searching. A dragon stack or a safe foundation move
+ * is forced: it is made as the only child, as a win never needs it held
+ * back. Otherwise, the legal moves are listed less those dominated by
+ * another: of the empty columns, only the first is a target, as they are
+ * interchangeable, and a whole column never moves to an empty one.
+ */
+uint8_t state_moves_pruned (const state_t *state, move_t *moves)
+{
+    uint8_t count = state_moves (state, moves);
+    uint8_t first_empty = NO_CARD;
+    uint8_t kept = 0;
+
+    /* state_moves () lists the dragon stacks and foundation moves first */
+    for (uint8_t i = 0; i < count && (moves [i].from == MOVE_DRAGONS || moves [i].to >= STACK_SNEP); i++)
+    {
+        uint8_t from = moves [i].from;
+
+        if (from == MOVE_DRAGONS ||
+            foundation_safe (state, from < 8 ? state->column [from] [state->height [from] - 1] : state->slot [from - STACK_SLOT_1]))
+        {
+            moves [0] = moves [i];
+            return 1;
+        }
+    }
+
+    for (uint8_t col = 0; col < 8; col++)
+    {
+        if (state->height [col] == 0)
+        {
+            first_empty = col;
+            break;
+        }
+    }
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const move_t *move = &moves [i];
+
+        if (move->to < 8 && state->height [move->to] == 0 &&
+            (move->to != first_empty || (move->from < 8 && move->count == state->height [move->from])))
+        {
+            continue;
+        }
+
+        moves [kept++] = *move;
+    }
+
+    return kept;
+}
+
+
+/*
+ * Make a move, noting in it what undo needs.
+ */
+void state_apply (state_t *state, move_t *move)
+{
+    uint8_t card;
+
+    if (move->from == MOVE_DRAGONS)
+    {
+        uint8_t dragon = 0x30 + move->count;
+
+        move->dragons_from = 0;
+
+        for (uint8_t col = 0; col < 8; col++)
+        {
+            uint8_t height = state->height [col];
+
+            if (height > 0 && state->column [col] [height - 1] == dragon)
+            {
+                column_pop (state, col);
+                move->dragons_from |= 1 << col;
+            }
+        }
+        for (uint8_t s = 0; s < 3; s++)
+        {
+            if (state->slot [s] == dragon)
+            {
+                slot_set (state, s, SLOT_EMPTY);
+                move->dragons_from |= 1 << (STACK_SLOT_1 + s);
+            }
+        }
+
+        slot_set (state, move->to - STACK_SLOT_1, SLOT_LOCKED | move->count);
+        return;
+    }
+
+    if (move->from < STACK_SLOT_1 && move->to < STACK_SLOT_1)
+    {
+        /* Column to column, keeping the run in order */
+        uint8_t start = state->height [move->from] - move->count;
+
+        for (uint8_t i = 0; i < move->count; i++)
+        {
+            column_push (state, move->to, state->column [move->from] [start + i]);
+        }
+        for (uint8_t i = 0; i < move->count; i++)
+        {
+            column_pop (state, move->from);
+        }
+        return;
+    }
+
+    /* Single cards */
+    if (move->from < STACK_SLOT_1)
+    {
+        card = column_pop (state, move->from);
+    }
+    else
+    {
+        card = state->slot [move->from - STACK_SLOT_1];
+        slot_set (state, move->from - STACK_SLOT_1, SLOT_EMPTY);
+    }
+
+    if (move->to < STACK_SLOT_1)
+    {
+        column_push (state, move->to, card);
+    }
+    else if (move->to < STACK_SNEP)
+    {
+        slot_set (state, move->to - STACK_SLOT_1, card);
+    }
+    else if (move->to == STACK_SNEP)
+    {
+        state->snep = 1;
+    }
+    else
+    {
+        state->foundation [COLOUR (card)]++;
+    }
+}
+
+
+/*
+ * Take back the last move made.
+ */
+void state_undo (state_t *state, const move_t *move)
+{
+    uint8_t card;
+
+    if (move->from == MOVE_DRAGONS)
+    {
+        uint8_t dragon = 0x30 + move->count;
+
+        slot_set (state, move->to - STACK_SLOT_1, SLOT_EMPTY);
+
+        for (uint8_t s = 0; s < 3; s++)
+        {
+            if (move->dragons_from & (1 << (STACK_SLOT_1 + s)))
+            {
+                slot_set (state, s, dragon);
+            }
+        }
+        for (uint8_t col = 0; col < 8; col++)
+        {
+            if (move->dragons_from & (1 << col))
+            {
+                column_push (state, col, dragon);
+            }
+        }
+        return;
+    }
+
+    if (move->from < STACK_SLOT_1 && move->to < STACK_SLOT_1)
+    {
+        uint8_t start = state->height [move->to] - move->count;
+
+        for (uint8_t i = 0; i < move->count; i++)
+        {
+            column_push (state, move->from, state->column [move->to] [start + i]);
+        }
+        for (uint8_t i = 0; i < move->count; i++)
+        {
+            column_pop (state, move->to);
+        }
+        return;
+    }
+
+    /* Single cards */
+    if (move->to < STACK_SLOT_1)
+    {
+        card = column_pop (state, move->to);
+    }
+    else if (move->to < STACK_SNEP)
+    {
+        card = state->slot [move->to - STACK_SLOT_1];
+        slot_set (state, move->to - STACK_SLOT_1, SLOT_EMPTY);
+    }
+    else if (move->to == STACK_SNEP)
+    {
+        card = CARD_SNEP;
+        state->snep = 0;
+    }
+    else
+    {
+        uint8_t colour = move->to - STACK_FOUNDATION_1;
+
+        card = (colour << 4) | --state->foundation [colour];
+    }
+
+    if (move->from < STACK_SLOT_1)
+    {
+        column_push (state, move->from, card);
+    }
+    else
+    {
+        slot_set (state, move->from - STACK_SLOT_1, card);
+    }
+}
+
+
+/*
+ * A lower bound on the moves left to win:
+ *   - Each number card not home needs its own foundation move.
+ *   - The snep card, and each kind of dragon not yet stacked, needs one move.
+ *   - A column where a card sits above a lower card of its own colour needs
+ *     one more move: that card has to leave before the lower card can go
+ *     home, and it can't go home first. A run move may carry several such
+ *     cards at once, but only ever from one column, so count columns.
+ */
+uint8_t state_lower_bound (const state_t *state)
+{
+    uint8_t bound = 27 - state->foundation [0] - state->foundation [1] - state->foundation [2];
+
+    bound += !state->snep;
+
+    for (uint8_t kind = 0; kind < 3; kind++)
+    {
+        bool locked = false;
+
+        for (uint8_t s = 0; s < 3; s++)
+        {
+            locked |= (state->slot [s] == (SLOT_LOCKED | kind));
+        }
+
+        bound += !locked;
+    }
+
+    for (uint8_t col = 0; col < 8; col++)
+    {
+        /* Lowest value of each colour seen so far, working up from the bottom */
+        uint8_t lowest [3] = { 0xff, 0xff, 0xff };
+
+        for (uint8_t depth = 0; depth < state->height [col]; depth++)
+        {
+            uint8_t card = state->column [col] [depth];
+
+            if (IS_SPECIAL (card))
+            {
+                continue;
+            }
+
+            if (lowest [COLOUR (card)] < VALUE (card))
+            {
+                bound++;
+                break;
+            }
+
+            lowest [COLOUR (card)] = VALUE (card);
+        }
+    }
+
+    return bound;
+}
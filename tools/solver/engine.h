@@ -0,0 +1,43 @@
+/* Dragon slot contents, other than a loose card */
+#define SLOT_EMPTY      0x3f
+#define SLOT_LOCKED     0x38
+
+/*
+ * Board for in-place search: each column is a card array with an explicit
+ * height, the foundations are a count per colour, and the hash is kept up
+ * to date by every move.
+ */
+typedef struct state_s
+{
+    uint8_t column [8] [STACK_DEPTH];
+    uint8_t height [8];
+    uint8_t slot [3];
+    uint8_t foundation [3];
+    uint8_t snep;
+    uint64_t column_hash [8];
+    uint64_t hash;
+} state_t;
+
+/* Fill in the random numbers behind the hash. Call once before anything else. */
+void engine_init (void);
+
+/* Set up a state from a dealt board. */
+void state_from_board (state_t *state, const board_t *board);
+
+/* True once every tableau column is empty. */
+bool state_won (const state_t *state);
+
+/* List the legal moves, in the same order as board_moves (). Returns the number of moves. */
+uint8_t state_moves (const state_t *state, move_t *moves);
+
+/* List the moves worth searching: a forced move alone if there is one, otherwise the legal moves less dominated ones. */
+uint8_t state_moves_pruned (const state_t *state, move_t *moves);
+
+/* Make a move, noting in it what undo needs. */
+void state_apply (state_t *state, move_t *move);
+
+/* Take back the last move made. */
+void state_undo (state_t *state, const move_t *move);
+
+/* A lower bound on the moves left to win, for IDA* and best-first searches. */
+uint8_t state_lower_bound (const state_t *state);
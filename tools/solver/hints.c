@@ -0,0 +1,209 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "deal.h"
+#include "board.h"
+#include "hints.h"
+
+
+/*
+ * Append the low (bits) bits of a value to the stream, most significant first.
+ */
+static bool put (hints_t *hints, uint16_t value, uint8_t bits)
+{
+    if (hints->bits + bits > HINTS_BYTES * 8)
+    {
+        return false;
+    }
+
+    while (bits-- > 0)
+    {
+        if (value & (1 << bits))
+        {
+            hints->stream [hints->bits >> 3] |= 0x80 >> (hints->bits & 7);
+        }
+        hints->bits++;
+    }
+
+    return true;
+}
+
+
+/*
+ * Append a move, with the prefix code that hint.c decodes, shortest for
+ * the commonest moves:
+ *   0 ccc              column c to its foundation
+ *   10 ccc ddd         top card of column c onto column d
+ *   110 ccc            column c into the first empty slot
+ *   1110 ccc ddd nnn   n + 2 cards of column c onto column d
+ *   11110 kk           dragons of kind k into their slot; kind 3 ends the line
+ *   111110 ss ddd      slot s onto column d
+ *   111111 ss          slot s to its foundation
+ */
+static bool put_move (hints_t *hints, const move_t *move)
+{
+    if (move->from == MOVE_DRAGONS)
+    {
+        return put (hints, 0x78 | move->count, 7);
+    }
+
+    if (move->from < STACK_SLOT_1)
+    {
+        if (move->to >= STACK_SNEP)
+        {
+            return put (hints, move->from, 4);
+        }
+        if (move->to >= STACK_SLOT_1)
+        {
+            return put (hints, 0x30 | move->from, 6);
+        }
+        if (move->count == 1)
+        {
+            return put (hints, 0x80 | (move->from << 3) | move->to, 8);
+        }
+
+        return put (hints, 0x1c00 | (move->from << 6) | (move->to << 3) | (move->count - 2), 13);
+    }
+
+    if (move->to >= STACK_SNEP)
+    {
+        return put (hints, 0xfc | (move->from - STACK_SLOT_1), 8);
+    }
+
+    return put (hints, 0x7c0 | ((move->from - STACK_SLOT_1) << 3) | move->to, 11);
+}
+
+
+/*
+ * Append a deal's solution as a line, ended by the end marker. A line that
+ * does not fit is taken back, leaving the table as it was.
+ */
+bool hints_add (hints_t *hints, uint16_t seed, const move_t *moves, uint16_t length)
+{
+    uint32_t start = hints->bits;
+    uint8_t partial;
+    bool fits = true;
+
+    if (hints->count >= HINTS_MAX || start >= HINTS_BYTES * 8)
+    {
+        return false;
+    }
+    partial = hints->stream [start >> 3];
+
+    for (uint16_t i = 0; i < length && fits; i++)
+    {
+        fits = put_move (hints, &moves [i]);
+    }
+    fits = fits && put (hints, 0x7b, 7);
+
+    if (!fits)
+    {
+        memset (&hints->stream [start >> 3], 0, HINTS_BYTES - (start >> 3));
+        hints->stream [start >> 3] = partial;
+        hints->bits = start;
+        return false;
+    }
+
+    hints->seed [hints->count] = seed;
+    hints->start [hints->count] = start;
+    hints->count++;
+    hints->moves += length;
+
+    return true;
+}
+
+
+/*
+ * Put the lines added from now on in a difficulty bucket.
+ */
+void hints_bucket (hints_t *hints, uint8_t bucket)
+{
+    if (!hints->bucketed)
+    {
+        memset (hints->bucket, 0, sizeof (hints->bucket));
+        hints->bucketed = true;
+    }
+
+    for (uint8_t b = bucket; b < HINTS_BUCKETS; b++)
+    {
+        hints->bucket [b] = hints->count;
+    }
+}
+
+
+/*
+ * Write a table of uint16_t values as C.
+ */
+static void write_words (FILE *file, const char *name, const char *size, const uint16_t *words, uint16_t count)
+{
+    fprintf (file, "const uint16_t %s [%s] = {", name, size);
+    for (uint16_t i = 0; i < count; i++)
+    {
+        fprintf (file, "%s0x%04x%s", (i % 8) ? " " : "\n    ", words [i], (i + 1 < count) ? "," : "\n");
+    }
+    fprintf (file, "};\n\n");
+}
+
+
+/*
+ * Write the table as C source, to be included by the cartridge's hint.c.
+ */
+bool hints_write (const hints_t *hints, const char *path, const char *command)
+{
+    uint32_t bytes = (hints->bits + 7) / 8;
+    FILE *file = fopen (path, "w");
+
+    if (file == NULL)
+    {
+        perror (path);
+        return false;
+    }
+
+    fprintf (file, "/*\n"
+                   " * Hint lines: a winning sequence of moves for each deal, generated by\n"
+                   " *   %s\n"
+                   " * %u lines, %u moves in %u bytes (%.1f bits per move).\n"
+                   " */\n\n", command, hints->count, hints->moves, bytes, (double) hints->bits / hints->moves);
+    uint16_t first [HINTS_BUCKETS] = { 0 };
+    uint16_t lines [HINTS_BUCKETS];
+
+    /* A difficulty without lines deals any seed, and only the seeds in the table get a hint */
+    for (uint8_t b = 0; b < HINTS_BUCKETS; b++)
+    {
+        if (hints->bucketed)
+        {
+            first [b] = hints->bucket [b];
+            lines [b] = ((b + 1 < HINTS_BUCKETS) ? hints->bucket [b + 1] : hints->count) - first [b];
+        }
+        else
+        {
+            lines [b] = 0;
+        }
+    }
+
+    fprintf (file, "#define HINT_LINES %u\n\n", hints->count);
+
+    fprintf (file, "/* Lines for easy, normal and hard deals; one with none deals from every seed */\n");
+    write_words (file, "hint_first", "3", first, HINTS_BUCKETS);
+    write_words (file, "hint_lines", "3", lines, HINTS_BUCKETS);
+
+    write_words (file, "hint_seed", "HINT_LINES", hints->seed, hints->count);
+    write_words (file, "hint_line", "HINT_LINES", hints->start, hints->count);
+
+    fprintf (file, "const uint8_t hint_stream [%u] = {", bytes);
+    for (uint32_t i = 0; i < bytes; i++)
+    {
+        fprintf (file, "%s0x%02x%s", (i % 12) ? " " : "\n    ", hints->stream [i], (i + 1 < bytes) ? "," : "\n");
+    }
+    fprintf (file, "};\n");
+
+    if (fclose (file) != 0)
+    {
+        perror (path);
+        return false;
+    }
+
+    return true;
+}
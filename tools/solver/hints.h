@@ -0,0 +1,29 @@
+/* Most deals and stream bytes in the cartridge's hint table; bit offsets must fit in 16 bits */
+#define HINTS_MAX       1024
+#define HINTS_BYTES     8192
+
+/* Difficulties the cartridge chooses deals from: easy, normal and hard */
+#define HINTS_BUCKETS   3
+
+/* Solutions bit-packed as the cartridge's hint.c reads them, one line per deal */
+typedef struct hints_s
+{
+    uint16_t count;
+    uint16_t seed [HINTS_MAX];
+    uint16_t start [HINTS_MAX];     /* Bit offset of each line */
+    uint32_t bits;
+    uint32_t moves;
+    bool bucketed;
+    uint16_t bucket [HINTS_BUCKETS];    /* First line of each difficulty */
+    uint8_t stream [HINTS_BYTES];
+} hints_t;
+
+/* Put the lines added from now on in a difficulty bucket. An empty bucket, or a table without buckets, has the
+ * cartridge deal from every seed, with a hint for those that have a line. */
+void hints_bucket (hints_t *hints, uint8_t bucket);
+
+/* Append a deal's solution as a line. Returns false if the table is full. */
+bool hints_add (hints_t *hints, uint16_t seed, const move_t *moves, uint16_t length);
+
+/* Write the table as C source for the cartridge. */
+bool hints_write (const hints_t *hints, const char *path, const char *command);
@@ -0,0 +1,922 @@
+/*
+ * Shenzhen Solitaire Game Gear - deal solver
+ *
+ * Host-side tool that replays the cartridge's deal () for a seed and
+ * searches for a win, following the cartridge's move rules.
+ */
+
+#include <math.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "deal.h"
+#include "board.h"
+#include "table.h"
+#include "engine.h"
+#include "search.h"
+#include "spill.h"
+#include "portfolio.h"
+#include "hints.h"
+#include "rate.h"
+#include "playout.h"
+
+static const char *result_names [] = { "solved", "unsolvable", "gave up" };
+
+/* Search to run on each deal */
+#define MODE_INPLACE    0
+#define MODE_COPY       1
+#define MODE_IDASTAR    2
+#define MODE_PORTFOLIO  3
+#define MODE_BEAM       4
+
+/* Set by Ctrl-C or SIGTERM while spilling to a file */
+static atomic_bool interrupted;
+
+/* Strategy that decided the last portfolio search */
+static uint8_t winner;
+
+
+/*
+ * Seconds since an arbitrary point, for timing.
+ */
+static double now (void)
+{
+    struct timespec ts;
+
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+/*
+ * Ask the search to stop, leaving its path for the spill file.
+ */
+static void interrupt (int signal)
+{
+    (void) signal;
+    atomic_store (&interrupted, true);
+}
+
+
+/*
+ * Print resident memory and page faults so far, for spilled runs.
+ */
+static void print_usage (void)
+{
+    struct rusage usage;
+    unsigned long long pages = 0;
+    FILE *statm = fopen ("/proc/self/statm", "r");
+
+    if (statm != NULL)
+    {
+        if (fscanf (statm, "%*u %llu", &pages) != 1)
+        {
+            pages = 0;
+        }
+        fclose (statm);
+    }
+
+    getrusage (RUSAGE_SELF, &usage);
+
+    printf ("            rss %llu MB (peak %ld MB), page faults %ld major %ld minor\n",
+            pages * sysconf (_SC_PAGESIZE) >> 20, usage.ru_maxrss >> 10, usage.ru_majflt, usage.ru_minflt);
+}
+
+
+static void usage (void)
+{
+    fprintf (stderr,
+             "Usage: solver [options]\n"
+             "  -s SEED        Solve one seed and print the moves\n"
+             "  -r FIRST-LAST  Solve a range of seeds (default 0-99)\n"
+             "  -t BITS        Visited-state table of 2^BITS entries (default 20)\n"
+             "  -n NODES       Give up after this many nodes per deal (default 2000000)\n"
+             "  -c             Copy each board per node instead of making and undoing moves\n"
+             "  -a             IDA*: find the fewest moves to win\n"
+             "  -w WEIGHT      IDA* heuristic weight; above 1 is faster but not always fewest (default 1)\n"
+             "  -m MB          IDA* cost table or beam search memory cap (default 256)\n"
+             "  -f FILE        Keep the visited-state set in FILE, beyond RAM; Ctrl-C saves and the same command resumes\n"
+             "  -P             Portfolio: race greedy DFS, best-first and beam searches on three threads\n"
+             "  -R             Race report: run each strategy alone, then the portfolio, and compare wall-clock time\n"
+             "  -B             Beam search alone: a solution or unknown per deal, in the memory set by -m\n"
+             "  -X             With -B, search the unknown deals exhaustively\n"
+             "  -H             With -B, benchmark the scalar, SSE4.1 and AVX2 batch dedup kernels on each deal\n"
+             "  -W WIDTH       Beam width (default 1000)\n"
+             "  -o FILE        Write each solution as a hint line for the cartridge, as C source (such as source/hint_data.c)\n"
+             "  -M FILE        Rate each seed's difficulty into FILE: length of the win IDA* found (the fewest moves only at -w 1) and its nodes, forced dragon stacks, greedy-bot wins\n"
+             "  -j THREADS     Threads for -M and -G (default: every core)\n"
+             "  -k FILE        With -o, take the seeds from a ratings file, as easy, normal and hard buckets\n"
+             "  -K COUNT       Seeds per bucket for -k (default 32)\n"
+             "  -G GAMES       Monte Carlo: play GAMES games with each policy, dealing the seeds of -r in turn (default all)\n"
+             "  -g POLICY      With -G, play only random, greedy or auto\n"
+             "  -V             With -G, check every move list against the board rules and every game's undo\n"
+             "  -p             Plain moves: branch on every legal move, without macro-moves or pruning\n"
+             "  -x             Compare plain and pruned move lists on each deal: branching factor and nodes\n"
+             "  -b             Benchmark: run both searches on each deal and compare nodes per second\n");
+    exit (EXIT_FAILURE);
+}
+
+
+/*
+ * Run one search on a deal, timing it.
+ */
+static uint8_t run (search_t *search, const board_t *board, uint8_t mode, double *seconds)
+{
+    double start = now ();
+    uint8_t result;
+
+    switch (mode)
+    {
+        case MODE_COPY:
+            result = search_dfs (search, board);
+            break;
+        case MODE_IDASTAR:
+            result = search_idastar (search, board);
+            break;
+        case MODE_PORTFOLIO:
+            result = search_portfolio (search, board, &winner);
+            break;
+        case MODE_BEAM:
+            result = search_beam (search, board);
+            break;
+        default:
+            result = search_dfs_inplace (search, board);
+            break;
+    }
+
+    *seconds = now () - start;
+
+    return result;
+}
+
+
+/*
+ * Rate a range of seeds into a ratings file, then sum up each difficulty.
+ */
+static int rate (const char *path, search_t *settings, uint32_t first, uint32_t last, uint8_t threads, uint64_t memory)
+{
+    double start = now ();
+    double seconds;
+    ratings_t ratings;
+    uint32_t totals [3] = { 0 };
+    uint32_t bucket_first [DIFFICULTY_COUNT + 1];
+    uint32_t *seeds = malloc ((last - first + 1) * sizeof (uint32_t));
+
+    if (seeds == NULL || !ratings_write (path, settings, first, last, threads, memory) || !ratings_open (&ratings, path))
+    {
+        free (seeds);
+        return EXIT_FAILURE;
+    }
+    seconds = now () - start;
+
+    for (uint32_t i = 0; i < ratings.header->count; i++)
+    {
+        if (ratings.result [i] != RATING_NONE)
+        {
+            totals [ratings.result [i]]++;
+        }
+    }
+    printf ("%u seeds rated on %u threads in %.2f s, %.1f seeds/s: %u solved, %u unsolvable, %u gave up\n",
+            ratings.header->rated, threads, seconds, ratings.header->rated / seconds,
+            totals [SEARCH_SOLVED], totals [SEARCH_UNSOLVABLE], totals [SEARCH_GAVE_UP]);
+
+    /* Every solved seed, bucket by bucket */
+    bucket_first [DIFFICULTY_COUNT] = ratings_buckets (&ratings, UINT32_MAX, seeds, bucket_first);
+
+    for (uint8_t b = 0; b < DIFFICULTY_COUNT; b++)
+    {
+        double length = 0;
+        double nodes = 0;
+        double dragons = 0;
+        double greedy = 0;
+        uint32_t count = bucket_first [b + 1] - bucket_first [b];
+
+        for (uint32_t k = bucket_first [b]; k < bucket_first [b + 1]; k++)
+        {
+            uint32_t i = seeds [k] - first;
+
+            length += ratings.win_length [i];
+            nodes += ratings.nodes [i];
+            dragons += ratings.dragons [i];
+            greedy += ratings.greedy [i];
+        }
+
+        if (count > 0)
+        {
+            printf ("%-7s %6u seeds: %5.1f moves in the win found, %9.0f nodes, %4.2f forced dragon stacks, greedy bot wins %5.1f%%\n",
+                    difficulty_names [b], count, length / count, nodes / count, dragons / count,
+                    100 * greedy / count / GREEDY_GAMES);
+        }
+    }
+
+    ratings_close (&ratings);
+    free (seeds);
+
+    return EXIT_SUCCESS;
+}
+
+
+/*
+ * Play games with each policy on a thread pool, and report the win rate and
+ * cards sent home with 95% confidence intervals.
+ */
+static int montecarlo (uint64_t games, uint8_t policy, uint32_t first, uint32_t last, bool check, uint8_t threads)
+{
+    pool_t *pool = pool_create (threads);
+    uint64_t mismatches = 0;
+
+    if (pool == NULL)
+    {
+        fprintf (stderr, "Out of memory for the thread pool\n");
+        return EXIT_FAILURE;
+    }
+
+    printf ("%llu games per policy on %u threads, seeds %u-%u%s\n", (unsigned long long) games, threads, first, last,
+            check ? ", checking moves and undo" : "");
+
+    for (uint8_t p = 0; p < POLICY_COUNT; p++)
+    {
+        playout_stats_t stats;
+        double start = now ();
+        double seconds;
+        double z = 1.96;
+        double n;
+        double rate;
+        double centre;
+        double spread;
+        double home;
+        double deviation;
+
+        if (policy != POLICY_COUNT && p != policy)
+        {
+            continue;
+        }
+
+        pool_play (pool, p, games, first, last - first + 1, check, &stats);
+        seconds = now () - start;
+        mismatches += stats.mismatches;
+
+        /* Wilson score interval, which holds up for win rates near zero */
+        n = stats.games;
+        rate = stats.wins / n;
+        centre = (rate + z * z / (2 * n)) / (1 + z * z / n);
+        spread = z * sqrt (rate * (1 - rate) / n + z * z / (4 * n * n)) / (1 + z * z / n);
+
+        home = stats.home / n;
+        deviation = sqrt (fmax (stats.home_squares / n - home * home, 0));
+
+        printf ("%-7s wins %7.3f%% (95%% CI %.3f-%.3f%%), cards home %5.2f +/- %.2f, %5.1f moves, %.0f games/s",
+                policy_names [p], 100 * rate, 100 * fmax (centre - spread, 0), 100 * fmin (centre + spread, 1),
+                home, z * deviation / sqrt (n), (double) stats.moves / n, n / seconds);
+        if (check)
+        {
+            printf (", %llu mismatches", (unsigned long long) stats.mismatches);
+        }
+        printf ("\n");
+    }
+
+    pool_destroy (pool);
+
+    return (mismatches == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+
+int main (int argc, char **argv)
+{
+    uint32_t first = 0;
+    uint32_t last = 99;
+    bool print_moves = false;
+    uint8_t mode = MODE_INPLACE;
+    bool bench = false;
+    bool macros = true;
+    bool compare = false;
+    bool race = false;
+    uint32_t beam_width = 1000;
+    bool fallback = false;
+    bool kernels = false;
+    uint8_t kernel_best;
+    double kernel_seconds [KERNEL_COUNT] = { 0 };
+    uint8_t beam_bits = 8;
+    uint32_t unknown = 0;
+    beam_t beam = { 0 };
+    hashset_t exhaustive = { NULL, 0, 0, -1, 0 };
+    double race_seconds [STRATEGY_COUNT + 1] = { 0 };
+    uint32_t race_solved [STRATEGY_COUNT + 1] = { 0 };
+    sharedset_t shared = { NULL };
+    uint64_t compare_nodes [2] = { 0 };
+    uint64_t compare_children [2] = { 0 };
+    uint8_t table_bits = 20;
+    uint8_t weight = 1;
+    uint64_t memory_mb = 256;
+    uint64_t node_limit = 2000000;
+    uint32_t totals [3] = { 0 };
+    uint64_t total_nodes [2] = { 0 };
+    double total_seconds [2] = { 0 };
+    const char *spill_path = NULL;
+    const char *hints_path = NULL;
+    const char *ratings_path = NULL;
+    const char *buckets_path = NULL;
+    uint32_t per_bucket = 32;
+    uint32_t *seed_list = NULL;
+    uint32_t bucket_first [DIFFICULTY_COUNT];
+    long threads = sysconf (_SC_NPROCESSORS_ONLN);
+    uint64_t games = 0;
+    uint8_t policy = POLICY_COUNT;
+    bool check = false;
+    bool range = false;
+    static hints_t hints;
+    char command [256] = "solver";
+    spill_header_t *spill = NULL;
+    table_t table = { NULL };
+    hashset_t visited = { NULL, 0, 0, -1, 0 };
+    costtable_t costs = { NULL };
+    search_t search;
+    int opt;
+
+    while ((opt = getopt (argc, argv, "s:r:t:n:caw:m:f:PRBXHW:o:M:j:k:K:G:g:Vpxb")) != -1)
+    {
+        switch (opt)
+        {
+            case 's':
+                first = last = strtoul (optarg, NULL, 0);
+                print_moves = true;
+                break;
+            case 'r':
+                if (sscanf (optarg, "%u-%u", &first, &last) != 2)
+                {
+                    usage ();
+                }
+                range = true;
+                break;
+            case 't':
+                table_bits = atoi (optarg);
+                break;
+            case 'n':
+                node_limit = strtoull (optarg, NULL, 0);
+                break;
+            case 'c':
+                mode = MODE_COPY;
+                break;
+            case 'a':
+                mode = MODE_IDASTAR;
+                break;
+            case 'w':
+                weight = atoi (optarg);
+                break;
+            case 'm':
+                memory_mb = strtoull (optarg, NULL, 0);
+                break;
+            case 'f':
+                spill_path = optarg;
+                break;
+            case 'P':
+                mode = MODE_PORTFOLIO;
+                break;
+            case 'R':
+                race = true;
+                break;
+            case 'B':
+                mode = MODE_BEAM;
+                break;
+            case 'X':
+                fallback = true;
+                break;
+            case 'H':
+                kernels = true;
+                break;
+            case 'W':
+                beam_width = atoi (optarg);
+                break;
+            case 'o':
+                hints_path = optarg;
+                break;
+            case 'M':
+                ratings_path = optarg;
+                break;
+            case 'j':
+                threads = atoi (optarg);
+                break;
+            case 'k':
+                buckets_path = optarg;
+                break;
+            case 'K':
+                per_bucket = atoi (optarg);
+                break;
+            case 'G':
+                games = strtoull (optarg, NULL, 0);
+                break;
+            case 'g':
+                policy = 0;
+                while (strcmp (optarg, policy_names [policy]) != 0)
+                {
+                    if (++policy == POLICY_COUNT)
+                    {
+                        usage ();
+                    }
+                }
+                break;
+            case 'V':
+                check = true;
+                break;
+            case 'p':
+                macros = false;
+                break;
+            case 'x':
+                compare = true;
+                break;
+            case 'b':
+                bench = true;
+                break;
+            default:
+                usage ();
+        }
+    }
+
+    if (first > last || last > 0xffff || table_bits < 8 || table_bits > 34 || weight < 1 || memory_mb < 1 ||
+        (spill_path != NULL && (mode != MODE_INPLACE || bench || compare)) || (compare && (bench || mode == MODE_COPY)) ||
+        (race && (bench || compare || spill_path != NULL)) || beam_width < 1 || beam_width > 0xffffff ||
+        ((fallback || kernels) && mode != MODE_BEAM) || (fallback && kernels) || (mode == MODE_BEAM && (bench || compare || race)) ||
+        (hints_path != NULL && (bench || compare || race || kernels)) || threads < 1 || threads > 255 ||
+        (buckets_path != NULL && (hints_path == NULL || spill_path != NULL)) || per_bucket < 1 ||
+        (ratings_path != NULL && (hints_path != NULL || spill_path != NULL || bench || compare || race || mode == MODE_BEAM)) ||
+        ((policy != POLICY_COUNT || check) && games == 0) ||
+        (games > 0 && (ratings_path != NULL || hints_path != NULL || spill_path != NULL || bench || compare || race)))
+    {
+        usage ();
+    }
+
+    if (games > 0)
+    {
+        engine_init ();
+
+        return montecarlo (games, policy, range ? first : 0, range ? last : 0xffff, check, threads);
+    }
+
+    if (ratings_path != NULL)
+    {
+        engine_init ();
+        search.node_limit = node_limit;
+        search.weight = weight;
+        search.macros = macros;
+        search.cancel = NULL;
+        search.resume = false;
+
+        return rate (ratings_path, &search, first, last, threads, memory_mb << 20);
+    }
+
+    if (buckets_path != NULL)
+    {
+        /* The seeds to solve come from the ratings, easiest bucket first */
+        ratings_t ratings;
+
+        if (!ratings_open (&ratings, buckets_path))
+        {
+            return EXIT_FAILURE;
+        }
+
+        seed_list = malloc (DIFFICULTY_COUNT * per_bucket * sizeof (uint32_t));
+        if (seed_list == NULL)
+        {
+            fprintf (stderr, "Out of memory for the seed list\n");
+            return EXIT_FAILURE;
+        }
+
+        first = 0;
+        last = ratings_buckets (&ratings, per_bucket, seed_list, bucket_first);
+        ratings_close (&ratings);
+
+        if (last == 0)
+        {
+            fprintf (stderr, "No solved seeds in %s\n", buckets_path);
+            return EXIT_FAILURE;
+        }
+        last--;
+    }
+
+    if (mode == MODE_BEAM)
+    {
+        /*
+         * The visited set takes what the beam leaves of the memory cap, but
+         * no more than a deal is likely to fill: about a layer's children,
+         * some ten per state, for each of a couple of hundred moves. It is
+         * cleared for every deal, so a bigger set only costs time.
+         */
+        uint64_t bytes = memory_mb << 20;
+
+        if (beam_bytes (beam_width) + (sizeof (uint64_t) << beam_bits) > bytes)
+        {
+            fprintf (stderr, "A beam of width %u needs more than %llu MB\n", beam_width,
+                     (unsigned long long) (beam_bytes (beam_width) >> 20) + 1);
+            return EXIT_FAILURE;
+        }
+
+        while (beam_bits < 34 && beam_bytes (beam_width) + (sizeof (uint64_t) << (beam_bits + 1)) <= bytes &&
+               ((uint64_t) 1 << beam_bits) < (uint64_t) beam_width * 2048)
+        {
+            beam_bits++;
+        }
+        table_bits = beam_bits;
+    }
+
+    if (spill_path != NULL)
+    {
+        spill = spill_open (spill_path, table_bits, &visited);
+        if (spill == NULL)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    else if (!hashset_init (&visited, table_bits))
+    {
+        fprintf (stderr, "Out of memory for the visited-state table\n");
+        return EXIT_FAILURE;
+    }
+
+    if ((mode == MODE_COPY || bench) && !table_init (&table, table_bits))
+    {
+        fprintf (stderr, "Out of memory for the visited-state table\n");
+        return EXIT_FAILURE;
+    }
+
+    if ((mode == MODE_PORTFOLIO || race) && !sharedset_init (&shared, table_bits))
+    {
+        fprintf (stderr, "Out of memory for the shared visited-state table\n");
+        return EXIT_FAILURE;
+    }
+
+    if ((mode == MODE_PORTFOLIO || mode == MODE_BEAM || race) && !beam_init (&beam, beam_width))
+    {
+        fprintf (stderr, "Out of memory for the beam\n");
+        return EXIT_FAILURE;
+    }
+
+    if (fallback && !hashset_init (&exhaustive, 20))
+    {
+        fprintf (stderr, "Out of memory for the visited-state table\n");
+        return EXIT_FAILURE;
+    }
+
+    if (mode == MODE_IDASTAR && !costtable_init (&costs, memory_mb << 20))
+    {
+        fprintf (stderr, "Out of memory for the IDA* cost table\n");
+        return EXIT_FAILURE;
+    }
+
+    engine_init ();
+    kernel_best = hashset_kernel (KERNEL_AVX2);
+
+    search.table = &table;
+    search.visited = &visited;
+    search.costs = &costs;
+    search.node_limit = node_limit;
+    search.weight = weight;
+    search.macros = macros && !bench;
+    search.cancel = NULL;
+    search.shared = &shared;
+    search.beam = &beam;
+    search.resume = false;
+    search.resume_length = 0;
+
+    if (spill != NULL)
+    {
+        if (spill->interrupted)
+        {
+            /* Pick up the interrupted seed where it stopped, whatever range was asked for */
+            first = spill->seed;
+            last = spill->last;
+            memcpy (totals, spill->totals, sizeof (totals));
+            total_nodes [1] = spill->total_nodes;
+            total_seconds [1] = spill->total_seconds;
+
+            search.resume = true;
+            search.resume_length = spill->path_length;
+            search.resume_path = spill->path;
+            search.nodes = spill->nodes;
+            search.children = spill->children;
+            search.macros = spill->macros;
+
+            printf ("Resuming seed %u from %s: %llu nodes, %llu states, path of %u moves\n", first, spill_path,
+                    (unsigned long long) spill->nodes, (unsigned long long) visited.count, spill->path_length);
+        }
+        else
+        {
+            spill->first = first;
+            spill->last = last;
+            spill->macros = search.macros;
+        }
+
+        search.cancel = &interrupted;
+        signal (SIGINT, interrupt);
+        signal (SIGTERM, interrupt);
+    }
+
+    for (uint32_t i = first; i <= last; i++)
+    {
+        uint32_t seed = (seed_list != NULL) ? seed_list [i] : i;
+        board_t board;
+        uint8_t result;
+        double seconds;
+
+        for (uint8_t b = 0; seed_list != NULL && b < DIFFICULTY_COUNT; b++)
+        {
+            if (i == bucket_first [b])
+            {
+                hints_bucket (&hints, b);
+            }
+        }
+
+        deal (&board, seed);
+
+        if (bench)
+        {
+            /* Same deal, same move order: both should expand the same nodes */
+            uint64_t copy_nodes;
+            double copy_seconds;
+
+            run (&search, &board, MODE_COPY, &copy_seconds);
+            copy_nodes = search.nodes;
+            total_nodes [0] += copy_nodes;
+            total_seconds [0] += copy_seconds;
+
+            result = run (&search, &board, MODE_INPLACE, &seconds);
+            total_nodes [1] += search.nodes;
+            total_seconds [1] += seconds;
+            totals [result]++;
+
+            printf ("seed %5u: %-10s %10llu nodes  copy %9.0f/s  in-place %9.0f/s\n", seed, result_names [result],
+                    (unsigned long long) search.nodes, copy_nodes / copy_seconds, search.nodes / seconds);
+            continue;
+        }
+
+        if (kernels)
+        {
+            /* The same beam search with each kernel: only the time should differ */
+            uint8_t first_result = 0;
+            uint16_t first_length = 0;
+
+            printf ("seed %5u:", seed);
+            for (uint8_t k = 0; k <= kernel_best; k++)
+            {
+                hashset_kernel (k);
+                result = run (&search, &board, MODE_BEAM, &seconds);
+                kernel_seconds [k] += seconds;
+
+                if (k == 0)
+                {
+                    first_result = result;
+                    first_length = search.length;
+                }
+                else if (result != first_result || search.length != first_length)
+                {
+                    printf (" MISMATCH");
+                }
+                printf ("  %s %7.4f s", kernel_names [k], seconds);
+            }
+            totals [result]++;
+            printf ("  %s\n", result == SEARCH_GAVE_UP ? "unknown" : result_names [result]);
+            continue;
+        }
+
+        if (race)
+        {
+            /* Each strategy alone, then all together */
+            printf ("seed %5u:", seed);
+            for (uint8_t i = 0; i < STRATEGY_COUNT; i++)
+            {
+                double start = now ();
+
+                sharedset_clear (&shared);
+                result = search_strategy (&search, i, &board);
+                seconds = now () - start;
+                race_seconds [i] += seconds;
+                race_solved [i] += (result == SEARCH_SOLVED);
+
+                printf ("  %s %7.3f s", strategy_names [i], seconds);
+            }
+
+            result = run (&search, &board, MODE_PORTFOLIO, &seconds);
+            race_seconds [STRATEGY_COUNT] += seconds;
+            race_solved [STRATEGY_COUNT] += (result == SEARCH_SOLVED);
+            totals [result]++;
+
+            printf ("  portfolio %7.3f s: %s by %s\n", seconds, result_names [result],
+                    winner < STRATEGY_COUNT ? strategy_names [winner] : "none");
+            continue;
+        }
+
+        if (compare)
+        {
+            /* The same search both ways; the pruned list should branch less and finish sooner */
+            uint64_t plain_nodes;
+            uint64_t plain_children;
+
+            search.macros = false;
+            run (&search, &board, mode, &seconds);
+            plain_nodes = search.nodes;
+            plain_children = search.children;
+            compare_nodes [0] += plain_nodes;
+            compare_children [0] += plain_children;
+
+            search.macros = true;
+            result = run (&search, &board, mode, &seconds);
+            compare_nodes [1] += search.nodes;
+            compare_children [1] += search.children;
+            totals [result]++;
+
+            printf ("seed %5u: %-10s plain %9llu nodes, branching %5.2f  pruned %9llu nodes, branching %5.2f\n",
+                    seed, result_names [result], (unsigned long long) plain_nodes, (double) plain_children / plain_nodes,
+                    (unsigned long long) search.nodes, (double) search.children / search.nodes);
+            continue;
+        }
+
+        if (spill != NULL)
+        {
+            spill->seed = seed;
+            spill->interrupted = false;
+        }
+
+        result = run (&search, &board, mode, &seconds);
+
+        if (spill != NULL && atomic_load (&interrupted))
+        {
+            /* Everything the search needs to carry on is in the file once the path is */
+            spill->nodes = search.nodes;
+            spill->children = search.children;
+            spill->path_length = search.length;
+            memcpy (spill->path, search.solution, search.length * sizeof (move_t));
+            spill->total_seconds += seconds;
+            spill->interrupted = true;
+            spill_close (spill, &visited);
+
+            printf ("seed %5u: interrupted after %llu nodes; run again with -f %s to resume\n", seed,
+                    (unsigned long long) search.nodes, spill_path);
+            print_usage ();
+            return EXIT_SUCCESS;
+        }
+
+        totals [result]++;
+        total_nodes [mode == MODE_COPY ? 0 : 1] += search.nodes;
+        total_seconds [mode == MODE_COPY ? 0 : 1] += seconds;
+
+        if (mode == MODE_BEAM && result == SEARCH_GAVE_UP)
+        {
+            unknown++;
+
+            if (fallback)
+            {
+                /* Searched exhaustively in a set of its own, so the beam's stays small */
+                uint64_t beam_nodes = search.nodes;
+
+                search.visited = &exhaustive;
+                totals [result]--;
+                result = run (&search, &board, MODE_INPLACE, &seconds);
+                totals [result]++;
+                total_nodes [1] += search.nodes;
+                total_seconds [1] += seconds;
+                search.visited = &visited;
+                search.nodes += beam_nodes;
+            }
+        }
+
+        if (mode == MODE_BEAM)
+        {
+            printf ("seed %5u: %-10s %4u moves %10llu nodes\n", seed,
+                    result == SEARCH_GAVE_UP ? "unknown" : result_names [result], search.length, (unsigned long long) search.nodes);
+        }
+        else if (mode == MODE_PORTFOLIO)
+        {
+            printf ("seed %5u: %-10s %4u moves %10llu nodes, by %s\n", seed, result_names [result], search.length,
+                    (unsigned long long) search.nodes, winner < STRATEGY_COUNT ? strategy_names [winner] : "none");
+        }
+        else if (mode == MODE_IDASTAR && result == SEARCH_GAVE_UP)
+        {
+            printf ("seed %5u: %-10s >=%3u moves %9llu nodes\n", seed, result_names [result],
+                    search.bound, (unsigned long long) search.nodes);
+        }
+        else
+        {
+            printf ("seed %5u: %-10s %4u moves %10llu nodes\n", seed, result_names [result],
+                    search.length, (unsigned long long) search.nodes);
+        }
+
+        if (spill != NULL)
+        {
+            memcpy (spill->totals, totals, sizeof (totals));
+            spill->total_nodes = total_nodes [1];
+            spill->total_seconds = total_seconds [1];
+            printf ("            %.0f nodes/s\n", search.nodes / seconds);
+            print_usage ();
+        }
+
+        if (hints_path != NULL && result == SEARCH_SOLVED && !hints_add (&hints, seed, search.solution, search.length))
+        {
+            printf ("            no room for its hint line\n");
+        }
+
+        if (print_moves && result == SEARCH_SOLVED)
+        {
+            for (uint16_t i = 0; i < search.length; i++)
+            {
+                printf ("  %3u: %s\n", i + 1, move_name (&search.solution [i]));
+            }
+        }
+    }
+
+    printf ("\n%u solved, %u unsolvable, %u gave up\n", totals [SEARCH_SOLVED], totals [SEARCH_UNSOLVABLE], totals [SEARCH_GAVE_UP]);
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        if (total_seconds [i] > 0)
+        {
+            printf ("%-9s %12llu nodes in %7.2f s, %10.0f nodes/s\n", i ? "in-place:" : "copy:",
+                    (unsigned long long) total_nodes [i], total_seconds [i], total_nodes [i] / total_seconds [i]);
+        }
+    }
+    if (kernels)
+    {
+        for (uint8_t k = 0; k <= kernel_best; k++)
+        {
+            printf ("%-7s %8.2f s, %.2fx scalar\n", kernel_names [k], kernel_seconds [k], kernel_seconds [0] / kernel_seconds [k]);
+        }
+    }
+    else if (mode == MODE_BEAM && total_seconds [1] > 0)
+    {
+        printf ("beam width %u in %llu MB (beam %llu MB, visited set 2^%u): %u unknown to the beam, %.1f deals/s\n",
+                beam_width, (unsigned long long) ((beam_bytes (beam_width) + (sizeof (uint64_t) << beam_bits)) >> 20),
+                (unsigned long long) (beam_bytes (beam_width) >> 20), beam_bits, unknown,
+                (last - first + 1) / total_seconds [1]);
+    }
+    if (race)
+    {
+        uint8_t best = 0;
+
+        for (uint8_t i = 0; i <= STRATEGY_COUNT; i++)
+        {
+            printf ("%-10s %5u solved in %8.2f s\n", i < STRATEGY_COUNT ? strategy_names [i] : "portfolio",
+                    race_solved [i], race_seconds [i]);
+            if (i < STRATEGY_COUNT && race_seconds [i] < race_seconds [best])
+            {
+                best = i;
+            }
+        }
+        printf ("portfolio speedup over %s alone: %.2fx wall-clock\n", strategy_names [best],
+                race_seconds [best] / race_seconds [STRATEGY_COUNT]);
+    }
+    if (compare && compare_nodes [0] > 0 && compare_nodes [1] > 0)
+    {
+        double plain = (double) compare_children [0] / compare_nodes [0];
+        double pruned = (double) compare_children [1] / compare_nodes [1];
+
+        printf ("plain:  %12llu nodes, branching factor %5.2f\n", (unsigned long long) compare_nodes [0], plain);
+        printf ("pruned: %12llu nodes, branching factor %5.2f (%.0f%% fewer moves per node, %.0f%% fewer nodes)\n",
+                (unsigned long long) compare_nodes [1], pruned, 100 * (1 - pruned / plain),
+                100 * (1 - (double) compare_nodes [1] / compare_nodes [0]));
+    }
+    if (hints_path != NULL)
+    {
+        /* The command goes in the file, so it can be made again */
+        for (int i = 1; i < argc; i++)
+        {
+            strncat (command, " ", sizeof (command) - strlen (command) - 1);
+            strncat (command, argv [i], sizeof (command) - strlen (command) - 1);
+        }
+
+        if (hints.moves == 0 || !hints_write (&hints, hints_path, command))
+        {
+            return EXIT_FAILURE;
+        }
+        printf ("%u hint lines, %u moves in %u bytes: %.1f bits per move\n", hints.count, hints.moves,
+                (hints.bits + 7) / 8, (double) hints.bits / hints.moves);
+    }
+    if (bench && total_seconds [0] > 0 && total_seconds [1] > 0)
+    {
+        printf ("speedup   %.2fx\n", (total_nodes [1] / total_seconds [1]) / (total_nodes [0] / total_seconds [0]));
+    }
+
+    free (seed_list);
+    table_free (&table);
+    sharedset_free (&shared);
+    beam_free (&beam);
+    hashset_free (&exhaustive);
+
+    if (spill != NULL)
+    {
+        spill_close (spill, &visited);
+    }
+    else
+    {
+        hashset_free (&visited);
+    }
+    costtable_free (&costs);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,444 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "deal.h"
+#include "board.h"
+#include "engine.h"
+#include "playout.h"
+
+const char *policy_names [POLICY_COUNT] = { "random", "greedy", "auto" };
+
+/* Games a worker takes from the job at a time */
+#define BATCH_GAMES     256
+
+/* Each worker's arena: all it writes while playing, on its own cache lines */
+#define ARENA_BYTES     16384
+#define CACHE_LINE      64
+
+/* A block that a worker allocates from once, when it starts */
+typedef struct arena_s
+{
+    uint8_t *base;
+    size_t used;
+} arena_t;
+
+/* One worker thread, and what it plays with */
+typedef struct worker_s
+{
+    pool_t *pool;
+    pthread_t thread;
+    arena_t arena;
+    state_t *state;
+    state_t *start;         /* The deal, to check undo against */
+    board_t *board;         /* The same game on the board rules, to check moves against */
+    move_t *moves;
+    move_t *board_moves;
+    move_t *history;
+    playout_stats_t *stats;
+} worker_t;
+
+struct pool_s
+{
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_cond_t done;
+    uint32_t job;           /* Counts the jobs posted, so a worker can tell a new one */
+    uint8_t busy;
+    bool quit;
+
+    /* The job */
+    uint8_t policy;
+    uint64_t games;
+    uint32_t first;
+    uint32_t seeds;
+    bool check;
+    atomic_uint_fast64_t next;
+
+    uint8_t threads;
+    worker_t *workers;
+};
+
+
+/*
+ * Take cache-line aligned memory from an arena. There is always room, as
+ * each worker asks for the same few fixed blocks.
+ */
+static void *arena_alloc (arena_t *arena, size_t bytes)
+{
+    void *block = arena->base + arena->used;
+
+    arena->used += (bytes + CACHE_LINE - 1) & ~(CACHE_LINE - 1);
+
+    return block;
+}
+
+
+/*
+ * Step a xorshift generator.
+ */
+static uint64_t next_random (uint64_t *random)
+{
+    *random ^= *random << 13;
+    *random ^= *random >> 7;
+    *random ^= *random << 17;
+
+    return *random;
+}
+
+
+/*
+ * Count the cards sent home: foundations, the snep card and stacked dragons.
+ */
+static uint8_t cards_home (const state_t *state)
+{
+    uint8_t home = state->foundation [0] + state->foundation [1] + state->foundation [2] + state->snep;
+
+    for (uint8_t s = 0; s < 3; s++)
+    {
+        if (state->slot [s] >= SLOT_LOCKED && state->slot [s] != SLOT_EMPTY)
+        {
+            home += 4;
+        }
+    }
+
+    return home;
+}
+
+
+/*
+ * Choose a move for a policy, or return count if it has none.
+ * state_moves () lists the dragon stacks and foundation moves first.
+ */
+static uint8_t choose (uint8_t policy, const move_t *moves, uint8_t count, const move_t *last, uint64_t *random)
+{
+    bool home = count > 0 && (moves [0].from == MOVE_DRAGONS || moves [0].to >= STACK_SNEP);
+    uint8_t i;
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    switch (policy)
+    {
+        case POLICY_RANDOM:
+            return next_random (random) % count;
+
+        case POLICY_GREEDY:
+            if (home)
+            {
+                return 0;
+            }
+
+            /* Anything but undoing the last move, unless that is all there is */
+            i = next_random (random) % count;
+            if (count > 1 && moves [i].from == last->to && moves [i].to == last->from && moves [i].count == last->count)
+            {
+                i = (i + 1 + next_random (random) % (count - 1)) % count;
+            }
+            return i;
+
+        default:
+            return home ? 0 : count;
+    }
+}
+
+
+/*
+ * Check that both rule sets list the same moves. The board sends a 1 to the
+ * first empty foundation where the engine keeps one for each colour, so any
+ * foundation matches any other.
+ */
+static bool moves_agree (const move_t *a, uint8_t a_count, const move_t *b, uint8_t b_count)
+{
+    if (a_count != b_count)
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < a_count; i++)
+    {
+        bool home = a [i].to >= STACK_FOUNDATION_1 && b [i].to >= STACK_FOUNDATION_1;
+
+        if (a [i].from != b [i].from || (a [i].to != b [i].to && !home) || a [i].count != b [i].count)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ * Check that two states hold the same game. Cards above a column's height
+ * are left behind by moves, so they don't count.
+ */
+static bool states_agree (const state_t *a, const state_t *b)
+{
+    if (a->hash != b->hash || memcmp (a->height, b->height, sizeof (a->height)) != 0 ||
+        memcmp (a->slot, b->slot, sizeof (a->slot)) != 0 ||
+        memcmp (a->foundation, b->foundation, sizeof (a->foundation)) != 0 || a->snep != b->snep)
+    {
+        return false;
+    }
+
+    for (uint8_t col = 0; col < 8; col++)
+    {
+        if (a->column_hash [col] != b->column_hash [col] || memcmp (a->column [col], b->column [col], a->height [col]) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ * Play one game to a win, a dead end or the move limit.
+ */
+static void play_game (worker_t *worker, uint8_t policy, uint16_t seed, uint64_t random, bool check)
+{
+    state_t *state = worker->state;
+    playout_stats_t *stats = worker->stats;
+    move_t last = { NO_CARD, NO_CARD, 0 };
+    bool mismatch = false;
+    uint16_t length = 0;
+    uint8_t home;
+    bool won;
+
+    deal (worker->board, seed);
+    state_from_board (state, worker->board);
+    if (check)
+    {
+        memcpy (worker->start, state, sizeof (state_t));
+    }
+
+    while (length < PLAYOUT_MOVES && !state_won (state))
+    {
+        uint8_t count = state_moves (state, worker->moves);
+        uint8_t i;
+
+        if (check)
+        {
+            uint8_t board_count = board_moves (worker->board, worker->board_moves);
+
+            mismatch |= !moves_agree (worker->moves, count, worker->board_moves, board_count);
+        }
+
+        i = choose (policy, worker->moves, count, &last, &random);
+        if (i == count)
+        {
+            break;
+        }
+
+        last = worker->moves [i];
+        state_apply (state, &last);
+        if (check)
+        {
+            board_apply (worker->board, &last);
+            worker->history [length] = last;
+        }
+        length++;
+    }
+
+    home = cards_home (state);
+    won = state_won (state);
+
+    if (check)
+    {
+        mismatch |= (board_won (worker->board) != won);
+
+        for (uint16_t m = length; m-- > 0;)
+        {
+            state_undo (state, &worker->history [m]);
+        }
+        mismatch |= !states_agree (state, worker->start);
+    }
+
+    stats->games++;
+    stats->wins += won;
+    stats->home += home;
+    stats->home_squares += home * home;
+    stats->moves += length;
+    stats->mismatches += mismatch;
+}
+
+
+/*
+ * Play batches of the current job's games until none are left.
+ */
+static void worker_play (worker_t *worker)
+{
+    pool_t *pool = worker->pool;
+    uint64_t start;
+
+    while ((start = atomic_fetch_add (&pool->next, BATCH_GAMES)) < pool->games)
+    {
+        uint64_t end = (start + BATCH_GAMES < pool->games) ? start + BATCH_GAMES : pool->games;
+
+        for (uint64_t game = start; game < end; game++)
+        {
+            /* Seeded by the game, so the results don't depend on the number of threads */
+            uint64_t random = ((game << 2 | pool->policy) + 1) * 0x9e3779b97f4a7c15 | 1;
+
+            play_game (worker, pool->policy, pool->first + game % pool->seeds, random, pool->check);
+        }
+    }
+}
+
+
+/*
+ * Thread body: wait for a job, play its games, and wait again.
+ */
+static void *worker_run (void *arg)
+{
+    worker_t *worker = arg;
+    pool_t *pool = worker->pool;
+    uint32_t job = 0;
+
+    pthread_mutex_lock (&pool->lock);
+    while (true)
+    {
+        while (pool->job == job && !pool->quit)
+        {
+            pthread_cond_wait (&pool->wake, &pool->lock);
+        }
+        if (pool->quit)
+        {
+            break;
+        }
+        job = pool->job;
+        pthread_mutex_unlock (&pool->lock);
+
+        worker_play (worker);
+
+        pthread_mutex_lock (&pool->lock);
+        if (--pool->busy == 0)
+        {
+            pthread_cond_signal (&pool->done);
+        }
+    }
+    pthread_mutex_unlock (&pool->lock);
+
+    return NULL;
+}
+
+
+/*
+ * Start a pool of worker threads.
+ */
+pool_t *pool_create (uint8_t threads)
+{
+    pool_t *pool = calloc (1, sizeof (pool_t));
+
+    if (pool == NULL || (pool->workers = calloc (threads, sizeof (worker_t))) == NULL)
+    {
+        free (pool);
+        return NULL;
+    }
+
+    pthread_mutex_init (&pool->lock, NULL);
+    pthread_cond_init (&pool->wake, NULL);
+    pthread_cond_init (&pool->done, NULL);
+
+    for (uint8_t t = 0; t < threads; t++)
+    {
+        worker_t *worker = &pool->workers [t];
+
+        worker->pool = pool;
+        worker->arena.base = aligned_alloc (CACHE_LINE, ARENA_BYTES);
+        if (worker->arena.base == NULL)
+        {
+            pool->threads = t;
+            pool_destroy (pool);
+            return NULL;
+        }
+
+        worker->stats = arena_alloc (&worker->arena, sizeof (playout_stats_t));
+        worker->state = arena_alloc (&worker->arena, sizeof (state_t));
+        worker->start = arena_alloc (&worker->arena, sizeof (state_t));
+        worker->board = arena_alloc (&worker->arena, sizeof (board_t));
+        worker->moves = arena_alloc (&worker->arena, MOVES_MAX * sizeof (move_t));
+        worker->board_moves = arena_alloc (&worker->arena, MOVES_MAX * sizeof (move_t));
+        worker->history = arena_alloc (&worker->arena, PLAYOUT_MOVES * sizeof (move_t));
+
+        pthread_create (&worker->thread, NULL, worker_run, worker);
+        pool->threads = t + 1;
+    }
+
+    return pool;
+}
+
+
+/*
+ * Play a batch of games on the pool and sum up what the workers found.
+ */
+void pool_play (pool_t *pool, uint8_t policy, uint64_t games, uint32_t first, uint32_t seeds, bool check,
+                playout_stats_t *stats)
+{
+    pthread_mutex_lock (&pool->lock);
+
+    pool->policy = policy;
+    pool->games = games;
+    pool->first = first;
+    pool->seeds = seeds;
+    pool->check = check;
+    atomic_store (&pool->next, 0);
+    for (uint8_t t = 0; t < pool->threads; t++)
+    {
+        memset (pool->workers [t].stats, 0, sizeof (playout_stats_t));
+    }
+
+    pool->busy = pool->threads;
+    pool->job++;
+    pthread_cond_broadcast (&pool->wake);
+    while (pool->busy > 0)
+    {
+        pthread_cond_wait (&pool->done, &pool->lock);
+    }
+
+    pthread_mutex_unlock (&pool->lock);
+
+    memset (stats, 0, sizeof (playout_stats_t));
+    for (uint8_t t = 0; t < pool->threads; t++)
+    {
+        const playout_stats_t *worker = pool->workers [t].stats;
+
+        stats->games += worker->games;
+        stats->wins += worker->wins;
+        stats->home += worker->home;
+        stats->home_squares += worker->home_squares;
+        stats->moves += worker->moves;
+        stats->mismatches += worker->mismatches;
+    }
+}
+
+
+/*
+ * Stop the workers and free the pool.
+ */
+void pool_destroy (pool_t *pool)
+{
+    pthread_mutex_lock (&pool->lock);
+    pool->quit = true;
+    pthread_cond_broadcast (&pool->wake);
+    pthread_mutex_unlock (&pool->lock);
+
+    for (uint8_t t = 0; t < pool->threads; t++)
+    {
+        pthread_join (pool->workers [t].thread, NULL);
+        free (pool->workers [t].arena.base);
+    }
+
+    pthread_mutex_destroy (&pool->lock);
+    pthread_cond_destroy (&pool->wake);
+    pthread_cond_destroy (&pool->done);
+    free (pool->workers);
+    free (pool);
+}
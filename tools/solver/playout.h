@@ -0,0 +1,35 @@
+/* Policies played by the Monte Carlo harness */
+#define POLICY_RANDOM   0   /* Any legal move */
+#define POLICY_GREEDY   1   /* Dragons and foundation moves first, otherwise any move but straight back */
+#define POLICY_AUTO     2   /* Only what move_auto () and the dragon buttons do: send cards home */
+#define POLICY_COUNT    3
+
+extern const char *policy_names [POLICY_COUNT];
+
+/* Most moves in a game before it is called lost */
+#define PLAYOUT_MOVES   400
+
+/* Totals over a batch of games */
+typedef struct playout_stats_s
+{
+    uint64_t games;
+    uint64_t wins;
+    uint64_t home;          /* Cards sent home, summed over the games */
+    uint64_t home_squares;  /* And their squares, for the spread */
+    uint64_t moves;
+    uint64_t mismatches;    /* With checking: moves lists or undos that disagreed */
+} playout_stats_t;
+
+/* Worker threads that stay up between batches, each with its own arena */
+typedef struct pool_s pool_t;
+
+/* Start a pool of worker threads. Returns NULL if out of memory. */
+pool_t *pool_create (uint8_t threads);
+
+/* Play (games) games with a policy on the pool, dealing the seeds from (first) on in turn, and wait for them.
+ * With (check), every move list is compared with board_moves () and every game is undone to the deal. */
+void pool_play (pool_t *pool, uint8_t policy, uint64_t games, uint32_t first, uint32_t seeds, bool check,
+                playout_stats_t *stats);
+
+/* Stop the workers and free the pool. */
+void pool_destroy (pool_t *pool);
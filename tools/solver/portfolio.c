@@ -0,0 +1,149 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "deal.h"
+#include "board.h"
+#include "table.h"
+#include "engine.h"
+#include "search.h"
+#include "portfolio.h"
+
+const char *strategy_names [STRATEGY_COUNT] = { "greedy", "best-first", "beam" };
+
+/* What the racing threads share */
+typedef struct race_s
+{
+    atomic_bool cancel;
+    atomic_int winner;
+    atomic_uint exhausted;
+} race_t;
+
+/* One thread in the race, with its own copy of the search */
+typedef struct racer_s
+{
+    search_t search;
+    uint8_t strategy;
+    uint8_t result;
+    const board_t *start;
+    race_t *race;
+    pthread_t thread;
+} racer_t;
+
+
+/*
+ * Run one strategy alone, in this thread.
+ */
+uint8_t search_strategy (search_t *search, uint8_t strategy, const board_t *start)
+{
+    switch (strategy)
+    {
+        case STRATEGY_DFS_GREEDY:
+            return search_dfs_greedy (search, start);
+        case STRATEGY_BEST_FIRST:
+            return search_best_first (search, start);
+        default:
+            return search_beam (search, start);
+    }
+}
+
+
+/*
+ * Claim the race for a strategy, stopping the others.
+ */
+static void race_decide (race_t *race, uint8_t strategy)
+{
+    int none = -1;
+
+    if (atomic_compare_exchange_strong (&race->winner, &none, strategy))
+    {
+        atomic_store (&race->cancel, true);
+    }
+}
+
+
+/*
+ * Thread body: run a strategy and report how it finished.
+ */
+static void *racer_run (void *arg)
+{
+    racer_t *racer = arg;
+    race_t *race = racer->race;
+
+    racer->result = search_strategy (&racer->search, racer->strategy, racer->start);
+
+    if (racer->result == SEARCH_SOLVED)
+    {
+        race_decide (race, racer->strategy);
+    }
+    else if (racer->result == SEARCH_UNSOLVABLE)
+    {
+        /* The beam keeps its own set, so alone it proves there is no win */
+        if (racer->strategy == STRATEGY_BEAM || atomic_fetch_add (&race->exhausted, 1) + 1 == 2)
+        {
+            race_decide (race, racer->strategy);
+        }
+    }
+
+    return NULL;
+}
+
+
+/*
+ * Race every strategy on its own thread. The first win found ends the
+ * race. The greedy and best-first searches split the states between them
+ * through the shared set, so neither finishing alone proves the deal
+ * unsolvable: that takes both, or an exhaustive beam. Nodes and children
+ * are summed over all threads.
+ */
+uint8_t search_portfolio (search_t *search, const board_t *start, uint8_t *winner)
+{
+    racer_t racers [STRATEGY_COUNT];
+    race_t race;
+    int decided;
+
+    atomic_init (&race.cancel, false);
+    atomic_init (&race.winner, -1);
+    atomic_init (&race.exhausted, 0);
+
+    sharedset_clear (search->shared);
+
+    for (uint8_t i = 0; i < STRATEGY_COUNT; i++)
+    {
+        racers [i].search = *search;
+        racers [i].search.cancel = &race.cancel;
+        racers [i].strategy = i;
+        racers [i].start = start;
+        racers [i].race = &race;
+        pthread_create (&racers [i].thread, NULL, racer_run, &racers [i]);
+    }
+
+    search->nodes = 0;
+    search->children = 0;
+    search->length = 0;
+
+    for (uint8_t i = 0; i < STRATEGY_COUNT; i++)
+    {
+        pthread_join (racers [i].thread, NULL);
+        search->nodes += racers [i].search.nodes;
+        search->children += racers [i].search.children;
+    }
+
+    decided = atomic_load (&race.winner);
+
+    if (decided < 0)
+    {
+        *winner = STRATEGY_COUNT;
+        return SEARCH_GAVE_UP;
+    }
+
+    *winner = decided;
+    search->length = racers [decided].search.length;
+    for (uint16_t i = 0; i < search->length; i++)
+    {
+        search->solution [i] = racers [decided].search.solution [i];
+    }
+
+    return racers [decided].result;
+}
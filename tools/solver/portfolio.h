@@ -0,0 +1,13 @@
+/* Strategies raced by search_portfolio () */
+#define STRATEGY_DFS_GREEDY     0
+#define STRATEGY_BEST_FIRST     1
+#define STRATEGY_BEAM           2
+#define STRATEGY_COUNT          3
+
+extern const char *strategy_names [STRATEGY_COUNT];
+
+/* Run one strategy alone, in this thread. The shared set must be clear. */
+uint8_t search_strategy (search_t *search, uint8_t strategy, const board_t *start);
+
+/* Race every strategy on its own thread; the first to finish stops the rest. Sets *winner to the strategy that decided. */
+uint8_t search_portfolio (search_t *search, const board_t *start, uint8_t *winner);
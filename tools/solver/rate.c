@@ -0,0 +1,440 @@
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "deal.h"
+#include "board.h"
+#include "table.h"
+#include "engine.h"
+#include "search.h"
+#include "rate.h"
+
+const char *difficulty_names [DIFFICULTY_COUNT] = { "easy", "normal", "hard" };
+
+/* Most moves the greedy bot makes before calling a game lost */
+#define GREEDY_MOVES    400
+
+/* What the rating threads share */
+typedef struct rating_run_s
+{
+    ratings_t *ratings;
+    const search_t *settings;
+    uint64_t memory;            /* For each thread's IDA* cost table */
+    atomic_uint next;           /* Index of the next seed to rate */
+    atomic_uint rated;
+} rating_run_t;
+
+/* One rating thread */
+typedef struct rater_s
+{
+    rating_run_t *run;
+    bool ok;
+    pthread_t thread;
+} rater_t;
+
+
+/*
+ * Lay the columns out after the header, widest first so each is aligned.
+ */
+static uint64_t ratings_layout (ratings_t *ratings, uint8_t *base, uint32_t count)
+{
+    uint64_t offset = (sizeof (ratings_header_t) + 7) & ~7;
+
+    ratings->header = (ratings_header_t *) base;
+    ratings->nodes = (uint32_t *) (base + offset);
+    offset += count * sizeof (uint32_t);
+    ratings->win_length = (uint16_t *) (base + offset);
+    offset += count * sizeof (uint16_t);
+    ratings->result = base + offset;
+    offset += count;
+    ratings->dragons = base + offset;
+    offset += count;
+    ratings->greedy = base + offset;
+    offset += count;
+
+    return offset;
+}
+
+
+/*
+ * Step a xorshift generator, for the greedy bot's tie-breaks.
+ */
+static uint64_t next_random (uint64_t *random)
+{
+    *random ^= *random << 13;
+    *random ^= *random >> 7;
+    *random ^= *random << 17;
+
+    return *random;
+}
+
+
+/*
+ * Count the dragon stacks in a win that had to be made with no slot free,
+ * taking the slot of one of the dragons being stacked.
+ */
+static uint8_t forced_dragons (const board_t *board, move_t *moves, uint16_t length)
+{
+    state_t state;
+    uint8_t forced = 0;
+
+    state_from_board (&state, board);
+
+    for (uint16_t m = 0; m < length; m++)
+    {
+        if (moves [m].from == MOVE_DRAGONS && state.slot [0] != SLOT_EMPTY && state.slot [1] != SLOT_EMPTY &&
+            state.slot [2] != SLOT_EMPTY)
+        {
+            forced++;
+        }
+        state_apply (&state, &moves [m]);
+    }
+
+    return forced;
+}
+
+
+/*
+ * Play one game as a greedy bot would: take a forced move when there is
+ * one, otherwise the move leaving the lowest lower bound, breaking ties at
+ * random, and never going back to a state seen this game.
+ */
+static bool greedy_game (const board_t *board, hashset_t *seen, uint64_t random)
+{
+    state_t state;
+
+    state_from_board (&state, board);
+    hashset_clear (seen);
+    hashset_insert (seen, state.hash);
+
+    for (uint16_t i = 0; i < GREEDY_MOVES; i++)
+    {
+        move_t moves [MOVES_MAX];
+        uint8_t count = state_moves_pruned (&state, moves);
+        uint8_t best = 0xff;
+        uint8_t best_bound = 0xff;
+        uint8_t ties = 0;
+
+        if (state_won (&state))
+        {
+            return true;
+        }
+
+        for (uint8_t m = 0; m < count; m++)
+        {
+            uint8_t bound;
+            bool fresh;
+
+            state_apply (&state, &moves [m]);
+            bound = state_lower_bound (&state);
+            fresh = !hashset_contains (seen, state.hash);
+            state_undo (&state, &moves [m]);
+
+            if (!fresh)
+            {
+                continue;
+            }
+
+            if (bound < best_bound)
+            {
+                best = m;
+                best_bound = bound;
+                ties = 1;
+            }
+            else if (bound == best_bound && next_random (&random) % ++ties == 0)
+            {
+                best = m;
+            }
+        }
+
+        if (best == 0xff)
+        {
+            return false;
+        }
+
+        state_apply (&state, &moves [best]);
+        hashset_insert (seen, state.hash);
+    }
+
+    return false;
+}
+
+
+/*
+ * Record in the file how many seeds are rated, so a run that is stopped
+ * still says how far it got. Threads finish out of order, so the count only
+ * ever goes up.
+ */
+static void note_rated (ratings_header_t *header, uint32_t rated)
+{
+    uint32_t noted = __atomic_load_n (&header->rated, __ATOMIC_RELAXED);
+
+    while (noted < rated &&
+           !__atomic_compare_exchange_n (&header->rated, &noted, rated, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+    {
+    }
+}
+
+
+/*
+ * Thread body: take seeds until there are none left, writing each one's
+ * metrics straight into the mapped file.
+ */
+static void *rater_run (void *arg)
+{
+    rater_t *rater = arg;
+    rating_run_t *run = rater->run;
+    ratings_t *ratings = run->ratings;
+    uint32_t count = ratings->header->count;
+    search_t *search = malloc (sizeof (search_t));
+    costtable_t costs = { NULL };
+    hashset_t seen = { NULL, 0, 0, -1, 0 };
+    uint32_t i;
+
+    rater->ok = search != NULL && costtable_init (&costs, run->memory) && hashset_init (&seen, 12);
+
+    while (rater->ok && (i = atomic_fetch_add (&run->next, 1)) < count)
+    {
+        uint32_t seed = ratings->header->first + i;
+        uint8_t wins = 0;
+        uint8_t dragons = 0;
+        uint8_t result;
+        board_t board;
+        uint32_t rated;
+
+        deal (&board, seed);
+
+        *search = *run->settings;
+        search->costs = &costs;
+        result = search_idastar (search, &board);
+
+        if (result == SEARCH_SOLVED)
+        {
+            dragons = forced_dragons (&board, search->solution, search->length);
+        }
+
+        for (uint8_t game = 0; game < GREEDY_GAMES; game++)
+        {
+            wins += greedy_game (&board, &seen, ((uint64_t) seed << 8 | game) * 0x9e3779b97f4a7c15 | 1);
+        }
+
+        /* The result goes in last, as it marks the seed rated */
+        ratings->nodes [i] = (search->nodes > UINT32_MAX) ? UINT32_MAX : search->nodes;
+        ratings->win_length [i] = (result == SEARCH_SOLVED) ? search->length : 0;
+        ratings->dragons [i] = dragons;
+        ratings->greedy [i] = wins;
+        __atomic_store_n (&ratings->result [i], result, __ATOMIC_RELEASE);
+
+        rated = atomic_fetch_add (&run->rated, 1) + 1;
+        note_rated (ratings->header, rated);
+        if (rated % 256 == 0 || rated == count)
+        {
+            fprintf (stderr, "\rrated %u of %u", rated, count);
+        }
+    }
+
+    costtable_free (&costs);
+    hashset_free (&seen);
+    free (search);
+
+    return NULL;
+}
+
+
+/*
+ * Rate each seed of a range, on many threads. Seeds are handed out one at
+ * a time, and each thread writes a seed's metrics into the mapped file as
+ * soon as it has them, so nothing builds up in memory however long the run.
+ */
+bool ratings_write (const char *path, const search_t *settings, uint32_t first, uint32_t last, uint8_t threads,
+                    uint64_t memory)
+{
+    uint32_t count = last - first + 1;
+    ratings_t ratings;
+    rating_run_t run;
+    rater_t *raters = calloc (threads, sizeof (rater_t));
+    uint64_t bytes = ratings_layout (&ratings, NULL, count);
+    bool ok = true;
+    uint8_t *base;
+    int fd = open (path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+    if (fd < 0 || raters == NULL || ftruncate (fd, bytes) != 0)
+    {
+        perror (path);
+        free (raters);
+        return false;
+    }
+
+    base = mmap (NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close (fd);
+    if (base == MAP_FAILED)
+    {
+        perror (path);
+        free (raters);
+        return false;
+    }
+
+    ratings_layout (&ratings, base, count);
+    memcpy (ratings.header->magic, RATINGS_MAGIC, 8);
+    ratings.header->first = first;
+    ratings.header->count = count;
+    ratings.header->weight = settings->weight;
+    memset (ratings.result, RATING_NONE, count);
+
+    run.ratings = &ratings;
+    run.settings = settings;
+    run.memory = memory / threads;
+    atomic_init (&run.next, 0);
+    atomic_init (&run.rated, 0);
+
+    for (uint8_t t = 0; t < threads; t++)
+    {
+        raters [t].run = &run;
+        pthread_create (&raters [t].thread, NULL, rater_run, &raters [t]);
+    }
+    for (uint8_t t = 0; t < threads; t++)
+    {
+        pthread_join (raters [t].thread, NULL);
+        ok = ok && raters [t].ok;
+    }
+    fprintf (stderr, "\n");
+
+    if (!ok)
+    {
+        fprintf (stderr, "Out of memory for a rating thread\n");
+    }
+
+    munmap (base, bytes);
+    free (raters);
+
+    return ok;
+}
+
+
+/*
+ * Map a ratings file to read.
+ */
+bool ratings_open (ratings_t *ratings, const char *path)
+{
+    ratings_header_t header;
+    uint8_t *base;
+    int fd = open (path, O_RDONLY);
+
+    if (fd < 0 || read (fd, &header, sizeof (header)) != sizeof (header) ||
+        memcmp (header.magic, RATINGS_MAGIC, 8) != 0)
+    {
+        fprintf (stderr, "%s: not a ratings file\n", path);
+        if (fd >= 0)
+        {
+            close (fd);
+        }
+        return false;
+    }
+
+    ratings->bytes = ratings_layout (ratings, NULL, header.count);
+    base = mmap (NULL, ratings->bytes, PROT_READ, MAP_SHARED, fd, 0);
+    close (fd);
+    if (base == MAP_FAILED)
+    {
+        perror (path);
+        return false;
+    }
+
+    ratings_layout (ratings, base, header.count);
+
+    return true;
+}
+
+
+/*
+ * Unmap a ratings file.
+ */
+void ratings_close (ratings_t *ratings)
+{
+    munmap (ratings->header, ratings->bytes);
+}
+
+
+/* The ratings being sorted, for compare_difficulty () */
+static const ratings_t *sorting;
+
+
+/*
+ * Order seeds easiest first: by games the greedy bot won, then by the
+ * length of the win, then by the nodes it took to find.
+ */
+static int compare_difficulty (const void *a, const void *b)
+{
+    uint32_t i = *(const uint32_t *) a;
+    uint32_t j = *(const uint32_t *) b;
+
+    if (sorting->greedy [i] != sorting->greedy [j])
+    {
+        return sorting->greedy [j] - sorting->greedy [i];
+    }
+    if (sorting->win_length [i] != sorting->win_length [j])
+    {
+        return sorting->win_length [i] - sorting->win_length [j];
+    }
+    if (sorting->nodes [i] != sorting->nodes [j])
+    {
+        return (sorting->nodes [i] < sorting->nodes [j]) ? -1 : 1;
+    }
+
+    return (i < j) ? -1 : (i > j);
+}
+
+
+/*
+ * Rank the solved seeds by difficulty, split them in three, and take
+ * seeds evenly spaced across each third, so each bucket covers its whole
+ * range rather than its easiest end.
+ */
+uint32_t ratings_buckets (const ratings_t *ratings, uint32_t per_bucket, uint32_t *seeds, uint32_t *bucket_first)
+{
+    uint32_t seeds_in_file = ratings->header->count;
+    uint32_t *order = malloc (seeds_in_file * sizeof (uint32_t));
+    uint32_t solved = 0;
+    uint32_t count = 0;
+
+    if (order == NULL)
+    {
+        return 0;
+    }
+
+    /* Any seed may be missing from a stopped run, as threads take them in turn */
+    for (uint32_t i = 0; i < seeds_in_file; i++)
+    {
+        if (ratings->result [i] == SEARCH_SOLVED)
+        {
+            order [solved++] = i;
+        }
+    }
+
+    sorting = ratings;
+    qsort (order, solved, sizeof (uint32_t), compare_difficulty);
+
+    for (uint8_t b = 0; b < DIFFICULTY_COUNT; b++)
+    {
+        uint32_t start = solved * b / DIFFICULTY_COUNT;
+        uint32_t size = solved * (b + 1) / DIFFICULTY_COUNT - start;
+        uint32_t take = (per_bucket < size) ? per_bucket : size;
+
+        bucket_first [b] = count;
+        for (uint32_t k = 0; k < take; k++)
+        {
+            seeds [count++] = ratings->header->first + order [start + (uint64_t) k * size / take];
+        }
+    }
+
+    free (order);
+
+    return count;
+}
@@ -0,0 +1,55 @@
+/* First bytes of a ratings file, marking it as one */
+#define RATINGS_MAGIC   "SZRATE01"
+
+/* Result of a seed not rated yet, as left by a run that was stopped */
+#define RATING_NONE     0xff
+
+/* Games the greedy bot plays on each deal */
+#define GREEDY_GAMES    16
+
+/* Difficulty buckets, easiest first */
+#define DIFFICULTY_EASY     0
+#define DIFFICULTY_NORMAL   1
+#define DIFFICULTY_HARD     2
+#define DIFFICULTY_COUNT    3
+
+extern const char *difficulty_names [DIFFICULTY_COUNT];
+
+/*
+ * Ratings file: this header, then one column per metric with an entry for
+ * each seed from first, so a metric can be read without the others.
+ */
+typedef struct ratings_header_s
+{
+    char magic [8];
+    uint32_t first;
+    uint32_t count;
+    uint32_t rated;         /* Seeds rated so far, kept up as they finish; the rest have result RATING_NONE */
+    uint8_t weight;         /* IDA* weight the lengths were found with: 1 for the fewest moves */
+} ratings_header_t;
+
+/* A mapped ratings file */
+typedef struct ratings_s
+{
+    ratings_header_t *header;
+    uint32_t *nodes;        /* Nodes expanded by the IDA* search */
+    uint16_t *win_length;   /* Moves in the win it found, or 0: the fewest only when weight is 1 */
+    uint8_t *result;        /* SEARCH_SOLVED, SEARCH_UNSOLVABLE, SEARCH_GAVE_UP or RATING_NONE */
+    uint8_t *dragons;       /* Dragon stacks in that win made with no slot free */
+    uint8_t *greedy;        /* Games won by the greedy bot, of GREEDY_GAMES */
+    uint64_t bytes;
+} ratings_t;
+
+/* Rate each seed of a range with IDA* and the greedy bot, on many threads, writing each seed's metrics to the file as it is done. */
+bool ratings_write (const char *path, const search_t *settings, uint32_t first, uint32_t last, uint8_t threads,
+                    uint64_t memory);
+
+/* Map a ratings file to read. */
+bool ratings_open (ratings_t *ratings, const char *path);
+
+/* Unmap a ratings file. */
+void ratings_close (ratings_t *ratings);
+
+/* Rank the solved seeds by difficulty, split them in three, and take (per_bucket) seeds spread across each.
+ * Fills seeds [] bucket by bucket and the index of each bucket's first seed. Returns the number of seeds. */
+uint32_t ratings_buckets (const ratings_t *ratings, uint32_t per_bucket, uint32_t *seeds, uint32_t *bucket_first);
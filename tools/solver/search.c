@@ -0,0 +1,834 @@
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "deal.h"
+#include "board.h"
+#include "table.h"
+#include "engine.h"
+#include "search.h"
+
+
+/*
+ * Expand one board. Each child is a copy of its parent with one move made.
+ */
+static uint8_t dfs (search_t *search, const board_t *board, uint16_t depth)
+{
+    move_t moves [MOVES_MAX];
+    uint8_t count;
+    bool gave_up = false;
+
+    if (board_won (board))
+    {
+        search->length = depth;
+        return SEARCH_SOLVED;
+    }
+
+    if (search->nodes >= search->node_limit || depth >= SOLUTION_MAX)
+    {
+        return SEARCH_GAVE_UP;
+    }
+    search->nodes++;
+
+    count = board_moves (board, moves);
+    search->children += count;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        board_t child = *board;
+        packed_t key;
+        uint8_t result;
+
+        board_apply (&child, &moves [i]);
+        board_key (&child, &key);
+
+        switch (table_insert (search->table, &key, key_hash (&key)))
+        {
+            case TABLE_PRESENT:
+                continue;
+            case TABLE_FULL:
+                return SEARCH_GAVE_UP;
+        }
+
+        result = dfs (search, &child, depth + 1);
+
+        if (result == SEARCH_SOLVED)
+        {
+            search->solution [depth] = moves [i];
+            return SEARCH_SOLVED;
+        }
+        if (result == SEARCH_GAVE_UP)
+        {
+            gave_up = true;
+        }
+    }
+
+    return gave_up ? SEARCH_GAVE_UP : SEARCH_UNSOLVABLE;
+}
+
+
+/*
+ * Depth-first search for any win from a board. Positions reached before,
+ * in any column or slot order, are not searched again.
+ */
+uint8_t search_dfs (search_t *search, const board_t *start)
+{
+    packed_t key;
+
+    search->nodes = 0;
+    search->children = 0;
+    search->length = 0;
+
+    table_clear (search->table);
+    board_key (start, &key);
+    table_insert (search->table, &key, key_hash (&key));
+
+    return dfs (search, start, 0);
+}
+
+
+/*
+ * True once the search has been asked to stop.
+ */
+static inline bool cancelled (const search_t *search)
+{
+    return search->cancel != NULL && atomic_load_explicit (search->cancel, memory_order_relaxed);
+}
+
+
+/*
+ * Expand one state in place: make each move, search, then undo it. The
+ * path so far is kept in solution, so a cancelled search can be resumed.
+ */
+static uint8_t dfs_inplace (search_t *search, state_t *state, uint16_t depth)
+{
+    move_t moves [MOVES_MAX];
+    uint8_t count;
+    bool gave_up = false;
+
+    if (state_won (state))
+    {
+        search->length = depth;
+        return SEARCH_SOLVED;
+    }
+
+    if (cancelled (search))
+    {
+        search->length = depth;
+        return SEARCH_GAVE_UP;
+    }
+
+    if (search->nodes >= search->node_limit || depth >= SOLUTION_MAX)
+    {
+        return SEARCH_GAVE_UP;
+    }
+
+    /* States back down a resumed path were counted before the interruption */
+    if (depth >= search->resume_length)
+    {
+        search->nodes++;
+    }
+
+    count = search->macros ? state_moves_pruned (state, moves) : state_moves (state, moves);
+    search->children += count;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        uint8_t result;
+        bool on_path = false;
+
+        state_apply (state, &moves [i]);
+
+        /* When resuming, states on the interrupted path are in the set but not yet finished */
+        if (depth < search->resume_length)
+        {
+            const move_t *next = &search->resume_path [depth];
+
+            on_path = moves [i].from == next->from && moves [i].to == next->to && moves [i].count == next->count;
+        }
+
+        if (!on_path)
+        {
+            switch (hashset_insert (search->visited, state->hash))
+            {
+                case TABLE_PRESENT:
+                    state_undo (state, &moves [i]);
+                    continue;
+                case TABLE_FULL:
+                    state_undo (state, &moves [i]);
+                    return SEARCH_GAVE_UP;
+            }
+        }
+
+        search->solution [depth] = moves [i];
+        result = dfs_inplace (search, state, depth + 1);
+        state_undo (state, &moves [i]);
+
+        if (on_path)
+        {
+            search->resume_length = 0;
+        }
+
+        if (result == SEARCH_SOLVED)
+        {
+            return SEARCH_SOLVED;
+        }
+        if (result == SEARCH_GAVE_UP)
+        {
+            /* Leave the path intact, and no sibling marked visited but unsearched */
+            if (cancelled (search))
+            {
+                return SEARCH_GAVE_UP;
+            }
+            gave_up = true;
+        }
+    }
+
+    return gave_up ? SEARCH_GAVE_UP : SEARCH_UNSOLVABLE;
+}
+
+
+/*
+ * Depth-first search for any win, making and undoing moves on one state.
+ * When resuming, the visited set and node count are kept, and the search
+ * follows the saved path back down before carrying on. As every state off
+ * that path in the set was searched to the end, the result is the same as
+ * an uninterrupted run.
+ */
+uint8_t search_dfs_inplace (search_t *search, const board_t *start)
+{
+    state_t state;
+
+    search->length = 0;
+
+    state_from_board (&state, start);
+
+    if (!search->resume)
+    {
+        search->nodes = 0;
+        search->children = 0;
+        search->resume_length = 0;
+        hashset_clear (search->visited);
+        hashset_insert (search->visited, state.hash);
+    }
+    search->resume = false;
+
+    return dfs_inplace (search, &state, 0);
+}
+
+
+/*
+ * One IDA* pass: search depth-first, cutting off any state whose cost so
+ * far plus its weighted lower bound is over the threshold. Returns the
+ * smallest cut-off value in *next, to become the following threshold.
+ */
+static uint8_t ida (search_t *search, state_t *state, uint16_t depth, uint16_t threshold, uint16_t *next)
+{
+    move_t moves [MOVES_MAX];
+    uint8_t count;
+    uint16_t f;
+    bool gave_up = false;
+
+    if (state_won (state))
+    {
+        search->length = depth;
+        return SEARCH_SOLVED;
+    }
+
+    f = depth + search->weight * state_lower_bound (state);
+
+    if (f > threshold)
+    {
+        if (f < *next)
+        {
+            *next = f;
+        }
+        return SEARCH_UNSOLVABLE;
+    }
+
+    if (search->nodes >= search->node_limit || depth >= SOLUTION_MAX)
+    {
+        return SEARCH_GAVE_UP;
+    }
+    search->nodes++;
+
+    count = search->macros ? state_moves_pruned (state, moves) : state_moves (state, moves);
+    search->children += count;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        uint8_t result;
+
+        state_apply (state, &moves [i]);
+
+        /* Reached as cheaply already this pass: everything below was searched */
+        if (!costtable_visit (search->costs, state->hash, depth + 1))
+        {
+            state_undo (state, &moves [i]);
+            continue;
+        }
+
+        result = ida (search, state, depth + 1, threshold, next);
+        state_undo (state, &moves [i]);
+
+        if (result == SEARCH_SOLVED)
+        {
+            search->solution [depth] = moves [i];
+            return SEARCH_SOLVED;
+        }
+        if (result == SEARCH_GAVE_UP)
+        {
+            gave_up = true;
+        }
+    }
+
+    return gave_up ? SEARCH_GAVE_UP : SEARCH_UNSOLVABLE;
+}
+
+
+/*
+ * Iterative-deepening A*. Each pass raises the threshold to the lowest
+ * value cut off by the one before, so with a weight of one the first win
+ * found has the fewest moves, counting a dragon stack or a run as one.
+ * The cost table only prunes: when it overflows, states are searched
+ * again rather than dropped, so memory stays fixed and results are exact.
+ * Each pass starts knowing no win is shorter than its threshold, which is
+ * kept in bound as the answer when the search gives up.
+ */
+uint8_t search_idastar (search_t *search, const board_t *start)
+{
+    state_t state;
+    uint16_t threshold;
+
+    search->nodes = 0;
+    search->children = 0;
+    search->length = 0;
+
+    state_from_board (&state, start);
+    threshold = search->weight * state_lower_bound (&state);
+
+    for (;;)
+    {
+        uint16_t next = 0xffff;
+        uint8_t result;
+
+        search->bound = threshold;
+        costtable_next (search->costs);
+        costtable_visit (search->costs, state.hash, 0);
+
+        result = ida (search, &state, 0, threshold, &next);
+
+        if (result != SEARCH_UNSOLVABLE)
+        {
+            return result;
+        }
+
+        /* Nothing was cut off: the whole reachable space was searched */
+        if (next == 0xffff)
+        {
+            return SEARCH_UNSOLVABLE;
+        }
+
+        threshold = next;
+    }
+}
+
+
+/*
+ * Expand one state of the greedy search: score each move by the lower
+ * bound it leaves, then search the moves best first. Ties keep the list
+ * order, which puts dragon stacks and foundation moves first.
+ */
+static uint8_t dfs_greedy (search_t *search, state_t *state, uint16_t depth)
+{
+    move_t moves [MOVES_MAX];
+    uint8_t bound [MOVES_MAX];
+    uint8_t order [MOVES_MAX];
+    uint8_t count;
+    bool gave_up = false;
+
+    if (state_won (state))
+    {
+        search->length = depth;
+        return SEARCH_SOLVED;
+    }
+
+    if (cancelled (search) || search->nodes >= search->node_limit || depth >= SOLUTION_MAX)
+    {
+        return SEARCH_GAVE_UP;
+    }
+    search->nodes++;
+
+    count = state_moves_pruned (state, moves);
+    search->children += count;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        uint8_t j = i;
+
+        state_apply (state, &moves [i]);
+        bound [i] = state_lower_bound (state);
+        state_undo (state, &moves [i]);
+
+        /* Insertion sort: the lists are short */
+        for (; j > 0 && bound [order [j - 1]] > bound [i]; j--)
+        {
+            order [j] = order [j - 1];
+        }
+        order [j] = i;
+    }
+
+    for (uint8_t k = 0; k < count; k++)
+    {
+        move_t *move = &moves [order [k]];
+        uint8_t result;
+
+        state_apply (state, move);
+
+        switch (sharedset_insert (search->shared, state->hash))
+        {
+            case TABLE_PRESENT:
+                state_undo (state, move);
+                continue;
+            case TABLE_FULL:
+                state_undo (state, move);
+                return SEARCH_GAVE_UP;
+        }
+
+        search->solution [depth] = *move;
+        result = dfs_greedy (search, state, depth + 1);
+        state_undo (state, move);
+
+        if (result == SEARCH_SOLVED)
+        {
+            return SEARCH_SOLVED;
+        }
+        if (result == SEARCH_GAVE_UP)
+        {
+            if (cancelled (search))
+            {
+                return SEARCH_GAVE_UP;
+            }
+            gave_up = true;
+        }
+    }
+
+    return gave_up ? SEARCH_GAVE_UP : SEARCH_UNSOLVABLE;
+}
+
+
+/*
+ * Depth-first search trying the most promising moves first. States are
+ * claimed in the shared set; every state this search claims, it searches
+ * to the end unless cancelled, so when it finishes alongside the
+ * best-first search, between them they have searched everything.
+ */
+uint8_t search_dfs_greedy (search_t *search, const board_t *start)
+{
+    state_t state;
+
+    search->nodes = 0;
+    search->children = 0;
+    search->length = 0;
+
+    state_from_board (&state, start);
+    sharedset_insert (search->shared, state.hash);
+
+    return dfs_greedy (search, &state, 0);
+}
+
+
+/*
+ * Best-first nodes hold only the move from their parent: a state is
+ * rebuilt by replaying its moves from the deal when it is expanded, which
+ * costs far less memory than keeping every state waiting in the queue.
+ */
+typedef struct open_node_s
+{
+    uint32_t parent;
+    uint16_t depth;
+    move_t move;
+} open_node_t;
+
+/* Queue entries: the priority above the node index, so ties go first-come first-served */
+#define OPEN_KEY(priority, index)   (((uint64_t) (priority) << 32) | (index))
+#define OPEN_INDEX(key)             ((uint32_t) (key))
+
+/* Priority of a state: its lower bound, weighted well above the moves made to reach it */
+#define OPEN_PRIORITY(depth, bound) (4 * (bound) + (depth))
+
+
+/*
+ * Add a key to a binary min-heap.
+ */
+static void heap_push (uint64_t *heap, uint32_t *size, uint64_t key)
+{
+    uint32_t i = (*size)++;
+
+    while (i > 0 && heap [(i - 1) / 2] > key)
+    {
+        heap [i] = heap [(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    heap [i] = key;
+}
+
+
+/*
+ * Take the smallest key from a binary min-heap.
+ */
+static uint64_t heap_pop (uint64_t *heap, uint32_t *size)
+{
+    uint64_t top = heap [0];
+    uint64_t last = heap [--(*size)];
+    uint32_t i = 0;
+
+    for (;;)
+    {
+        uint32_t child = 2 * i + 1;
+
+        if (child >= *size)
+        {
+            break;
+        }
+        if (child + 1 < *size && heap [child + 1] < heap [child])
+        {
+            child++;
+        }
+        if (heap [child] >= last)
+        {
+            break;
+        }
+        heap [i] = heap [child];
+        i = child;
+    }
+    heap [i] = last;
+
+    return top;
+}
+
+
+/*
+ * Copy the moves leading to a node into the solution.
+ */
+static void open_path (search_t *search, const open_node_t *nodes, uint32_t index)
+{
+    for (; index != 0; index = nodes [index].parent)
+    {
+        search->solution [nodes [index].depth - 1] = nodes [index].move;
+    }
+}
+
+
+/*
+ * Greedy best-first search: always expand the waiting state that looks
+ * closest to a win. Like the greedy search, it searches every state it
+ * claims in the shared set unless cancelled or out of nodes.
+ */
+uint8_t search_best_first (search_t *search, const board_t *start)
+{
+    state_t root;
+    open_node_t *nodes;
+    uint64_t *heap;
+    uint32_t node_count = 1;
+    uint32_t heap_size = 0;
+    uint32_t capacity = 1 << 16;
+    uint8_t result = SEARCH_UNSOLVABLE;
+
+    search->nodes = 0;
+    search->children = 0;
+    search->length = 0;
+
+    state_from_board (&root, start);
+
+    if (state_won (&root))
+    {
+        return SEARCH_SOLVED;
+    }
+    sharedset_insert (search->shared, root.hash);
+
+    nodes = malloc (capacity * sizeof (open_node_t));
+    heap = malloc (capacity * sizeof (uint64_t));
+    nodes [0] = (open_node_t) { 0, 0 };
+    heap_push (heap, &heap_size, OPEN_KEY (0, 0));
+
+    while (heap_size > 0)
+    {
+        uint32_t index = OPEN_INDEX (heap_pop (heap, &heap_size));
+        move_t moves [MOVES_MAX];
+        state_t state = root;
+        uint16_t depth = nodes [index].depth;
+        uint8_t count;
+
+        if (cancelled (search) || search->nodes >= search->node_limit)
+        {
+            result = SEARCH_GAVE_UP;
+            break;
+        }
+        search->nodes++;
+
+        /* Rebuild the state from the deal */
+        open_path (search, nodes, index);
+        for (uint16_t i = 0; i < depth; i++)
+        {
+            state_apply (&state, &search->solution [i]);
+        }
+
+        count = state_moves_pruned (&state, moves);
+        search->children += count;
+
+        if (depth + 1 >= SOLUTION_MAX)
+        {
+            result = SEARCH_GAVE_UP;
+            continue;
+        }
+
+        /* Make room for every child before adding any */
+        if (node_count + count > capacity)
+        {
+            if (capacity >= 1u << 30)
+            {
+                result = SEARCH_GAVE_UP;
+                break;
+            }
+            capacity *= 2;
+            nodes = realloc (nodes, capacity * sizeof (open_node_t));
+            heap = realloc (heap, capacity * sizeof (uint64_t));
+        }
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            state_apply (&state, &moves [i]);
+
+            if (state_won (&state))
+            {
+                search->solution [depth] = moves [i];
+                search->length = depth + 1;
+                free (nodes);
+                free (heap);
+                return SEARCH_SOLVED;
+            }
+
+            switch (sharedset_insert (search->shared, state.hash))
+            {
+                case TABLE_ADDED:
+                    nodes [node_count] = (open_node_t) { index, depth + 1, moves [i] };
+                    heap_push (heap, &heap_size, OPEN_KEY (OPEN_PRIORITY (depth + 1, state_lower_bound (&state)), node_count));
+                    node_count++;
+                    break;
+                case TABLE_FULL:
+                    result = SEARCH_GAVE_UP;
+                    break;
+            }
+
+            state_undo (&state, &moves [i]);
+        }
+    }
+
+    free (nodes);
+    free (heap);
+
+    return result;
+}
+
+
+/*
+ * A beam candidate: a move from a state in the current beam, and the
+ * lower bound it leaves, packed to sort as one integer.
+ */
+#define BEAM_KEY(bound, parent, move)   (((uint64_t) (bound) << 40) | ((uint64_t) (parent) << 8) | (move))
+#define BEAM_PARENT(key)                ((uint32_t) ((key) >> 8))
+#define BEAM_MOVE(key)                  ((uint8_t) (key))
+
+
+/*
+ * Bytes that beam_init () takes for a width: two beams of states, every
+ * move listed from one beam with a candidate key and hash for each, and the way
+ * back from each entry at every depth.
+ */
+uint64_t beam_bytes (uint32_t width)
+{
+    return (uint64_t) width * (2 * sizeof (state_t) + MOVES_MAX * (sizeof (move_t) + 2 * sizeof (uint64_t) + 1) +
+                               SOLUTION_MAX * (sizeof (uint32_t) + sizeof (move_t)));
+}
+
+
+/*
+ * Allocate beam buffers.
+ */
+bool beam_init (beam_t *beam, uint32_t width)
+{
+    beam->width = width;
+    beam->beam = malloc (width * sizeof (state_t));
+    beam->next = malloc (width * sizeof (state_t));
+    beam->moves = malloc ((size_t) width * MOVES_MAX * sizeof (move_t));
+    beam->candidates = malloc ((size_t) width * MOVES_MAX * sizeof (uint64_t));
+    beam->hashes = malloc ((size_t) width * MOVES_MAX * sizeof (uint64_t));
+    beam->results = malloc ((size_t) width * MOVES_MAX);
+    beam->parents = malloc ((size_t) SOLUTION_MAX * width * sizeof (uint32_t));
+    beam->steps = malloc ((size_t) SOLUTION_MAX * width * sizeof (move_t));
+
+    return beam->beam != NULL && beam->next != NULL && beam->moves != NULL &&
+           beam->candidates != NULL && beam->hashes != NULL && beam->results != NULL &&
+           beam->parents != NULL && beam->steps != NULL;
+}
+
+
+/*
+ * Free beam buffers.
+ */
+void beam_free (beam_t *beam)
+{
+    free (beam->beam);
+    free (beam->next);
+    free (beam->moves);
+    free (beam->candidates);
+    free (beam->hashes);
+    free (beam->results);
+    free (beam->parents);
+    free (beam->steps);
+    beam->beam = NULL;
+}
+
+
+static int beam_compare (const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *) a;
+    uint64_t y = *(const uint64_t *) b;
+
+    return (x > y) - (x < y);
+}
+
+
+/*
+ * Beam search: expand every state in the beam, then keep the children with
+ * the lowest lower bounds as the next beam. A layer's children are checked
+ * against the visited set in one batch, which overlaps the cache misses. Memory is fixed by the width and
+ * the visited set: when the set fills, new states are dropped rather than
+ * the search growing. Only the way each kept state was reached is
+ * remembered from one depth to the next, to rebuild the solution. States
+ * are deduplicated in search->visited, not the shared set, as a beam drops
+ * most states it finds and must not claim them. If nothing was ever
+ * dropped, the search was exhaustive and an empty beam proves the deal
+ * unsolvable; otherwise it only gives up.
+ */
+uint8_t search_beam (search_t *search, const board_t *start)
+{
+    beam_t *buffers = search->beam;
+    uint32_t width = buffers->width;
+    state_t *beam = buffers->beam;
+    state_t *next = buffers->next;
+    uint64_t *candidates = buffers->candidates;
+    uint32_t beam_size = 1;
+    bool dropped = false;
+
+    search->nodes = 0;
+    search->children = 0;
+    search->length = 0;
+
+    state_from_board (&beam [0], start);
+    hashset_clear (search->visited);
+    hashset_insert (search->visited, beam [0].hash);
+
+    if (state_won (&beam [0]))
+    {
+        return SEARCH_SOLVED;
+    }
+
+    for (uint16_t depth = 0; beam_size > 0; depth++)
+    {
+        uint32_t candidate_count = 0;
+
+        if (depth >= SOLUTION_MAX)
+        {
+            return SEARCH_GAVE_UP;
+        }
+
+        for (uint32_t b = 0; b < beam_size; b++)
+        {
+            move_t *moves = &buffers->moves [b * MOVES_MAX];
+            uint8_t count;
+
+            if (cancelled (search) || search->nodes >= search->node_limit)
+            {
+                return SEARCH_GAVE_UP;
+            }
+            search->nodes++;
+
+            count = state_moves_pruned (&beam [b], moves);
+            search->children += count;
+
+            for (uint8_t i = 0; i < count; i++)
+            {
+                state_apply (&beam [b], &moves [i]);
+
+                if (state_won (&beam [b]))
+                {
+                    /* Walk back up the beams for the moves that led here */
+                    uint32_t parent = b;
+
+                    state_undo (&beam [b], &moves [i]);
+                    search->solution [depth] = moves [i];
+                    for (uint16_t d = depth; d-- > 0;)
+                    {
+                        search->solution [d] = buffers->steps [d * width + parent];
+                        parent = buffers->parents [d * width + parent];
+                    }
+                    search->length = depth + 1;
+                    return SEARCH_SOLVED;
+                }
+
+                buffers->hashes [candidate_count] = beam [b].hash;
+                candidates [candidate_count++] = BEAM_KEY (state_lower_bound (&beam [b]), b, i);
+
+                state_undo (&beam [b], &moves [i]);
+            }
+        }
+
+        /* Keep the children not seen before */
+        hashset_insert_batch (search->visited, buffers->hashes, buffers->results, candidate_count);
+        {
+            uint32_t kept = 0;
+
+            for (uint32_t c = 0; c < candidate_count; c++)
+            {
+                if (buffers->results [c] == TABLE_ADDED)
+                {
+                    candidates [kept++] = candidates [c];
+                }
+                dropped |= (buffers->results [c] == TABLE_FULL);
+            }
+            candidate_count = kept;
+        }
+
+        if (candidate_count > width)
+        {
+            qsort (candidates, candidate_count, sizeof (uint64_t), beam_compare);
+            candidate_count = width;
+            dropped = true;
+        }
+
+        /* Build the next beam */
+        for (uint32_t c = 0; c < candidate_count; c++)
+        {
+            uint32_t parent = BEAM_PARENT (candidates [c]);
+            move_t *move = &buffers->moves [parent * MOVES_MAX + BEAM_MOVE (candidates [c])];
+
+            next [c] = beam [parent];
+            state_apply (&next [c], move);
+            buffers->parents [depth * width + c] = parent;
+            buffers->steps [depth * width + c] = *move;
+        }
+
+        {
+            state_t *swap = beam;
+            beam = next;
+            next = swap;
+        }
+        beam_size = candidate_count;
+    }
+
+    return dropped ? SEARCH_GAVE_UP : SEARCH_UNSOLVABLE;
+}
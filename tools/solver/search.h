@@ -0,0 +1,73 @@
+/* Outcome of a search */
+#define SEARCH_SOLVED       0
+#define SEARCH_UNSOLVABLE   1
+#define SEARCH_GAVE_UP      2
+
+#define SOLUTION_MAX        512
+
+/* Buffers for search_beam (), allocated once for a width and reused for every deal */
+typedef struct beam_s
+{
+    uint32_t width;
+    state_t *beam;
+    state_t *next;
+    move_t *moves;          /* The moves listed for each state in the beam */
+    uint64_t *candidates;
+    uint64_t *hashes;       /* Hash of each candidate, deduplicated as a batch */
+    uint8_t *results;
+    uint32_t *parents;      /* For each depth and beam entry, the entry it came from... */
+    move_t *steps;          /* ...and the move that got there */
+} beam_t;
+
+/* Bytes that beam_init () takes for a width. */
+uint64_t beam_bytes (uint32_t width);
+
+/* Allocate beam buffers. Returns false if out of memory. */
+bool beam_init (beam_t *beam, uint32_t width);
+
+/* Free beam buffers. */
+void beam_free (beam_t *beam);
+
+typedef struct search_s
+{
+    /* Settings */
+    table_t *table;
+    hashset_t *visited;
+    costtable_t *costs;
+    uint64_t node_limit;
+    uint8_t weight;
+    bool macros;                /* Search only state_moves_pruned () in the in-place searches */
+    atomic_bool *cancel;        /* Give up as soon as this is set, if not NULL */
+    sharedset_t *shared;        /* States claimed by the greedy and best-first searches, which may run together */
+    beam_t *beam;
+
+    /* Resuming: carry on an interrupted search_dfs_inplace () down this path, with the set and nodes as left */
+    bool resume;
+    uint16_t resume_length;
+    const move_t *resume_path;
+
+    /* Results */
+    uint64_t nodes;
+    uint64_t children;          /* Moves listed over all nodes: the branching factor is children / nodes */
+    uint16_t length;            /* On cancelling search_dfs_inplace (), the length of the path left in solution */
+    uint16_t bound;
+    move_t solution [SOLUTION_MAX];
+} search_t;
+
+/* Depth-first search for any win from a board. */
+uint8_t search_dfs (search_t *search, const board_t *start);
+
+/* Depth-first search for any win, making and undoing moves on one state. */
+uint8_t search_dfs_inplace (search_t *search, const board_t *start);
+
+/* Iterative-deepening A* for a win in the fewest moves. With a weight above one, h is scaled and the win may be longer. */
+uint8_t search_idastar (search_t *search, const board_t *start);
+
+/* Depth-first search trying the moves with the lowest lower bound first, claiming states in the shared set. */
+uint8_t search_dfs_greedy (search_t *search, const board_t *start);
+
+/* Greedy best-first search on the lower bound, claiming states in the shared set. */
+uint8_t search_best_first (search_t *search, const board_t *start);
+
+/* Beam search keeping the beam->width states with the lowest bounds at each depth, deduplicated in search->visited. */
+uint8_t search_beam (search_t *search, const board_t *start);
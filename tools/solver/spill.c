@@ -0,0 +1,112 @@
+#include <fcntl.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "deal.h"
+#include "board.h"
+#include "table.h"
+#include "engine.h"
+#include "search.h"
+#include "spill.h"
+
+
+/*
+ * Bytes taken by the header, rounded up to whole pages.
+ */
+static uint64_t header_bytes (void)
+{
+    uint64_t page = sysconf (_SC_PAGESIZE);
+
+    return (sizeof (spill_header_t) + page - 1) / page * page;
+}
+
+
+/*
+ * Open or create a spill file and map its set. A file holding an
+ * interrupted run is left as it is, set size included, for the caller to
+ * resume; anything else is reset to an empty set of 2^bits entries.
+ */
+spill_header_t *spill_open (const char *path, uint8_t bits, hashset_t *set)
+{
+    uint64_t offset = header_bytes ();
+    spill_header_t *header;
+    int fd = open (path, O_RDWR | O_CREAT, 0644);
+
+    if (fd < 0)
+    {
+        perror (path);
+        return NULL;
+    }
+
+    header = mmap (NULL, offset, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    if (lseek (fd, 0, SEEK_END) < (off_t) offset || header == MAP_FAILED ||
+        memcmp (header->magic, SPILL_MAGIC, 8) != 0 || !header->interrupted)
+    {
+        if (header != MAP_FAILED)
+        {
+            munmap (header, offset);
+        }
+
+        /* Truncating first leaves a sparse file: untouched pages cost no disk */
+        if (ftruncate (fd, 0) != 0 || ftruncate (fd, offset + (sizeof (uint64_t) << bits)) != 0)
+        {
+            perror (path);
+            close (fd);
+            return NULL;
+        }
+
+        header = mmap (NULL, offset, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (header == MAP_FAILED)
+        {
+            perror (path);
+            close (fd);
+            return NULL;
+        }
+
+        memcpy (header->magic, SPILL_MAGIC, 8);
+        header->bits = bits;
+    }
+
+    if (!hashset_map (set, header->bits, fd, offset))
+    {
+        perror (path);
+        munmap (header, offset);
+        close (fd);
+        return NULL;
+    }
+    set->count = header->count;
+
+    return header;
+}
+
+
+/*
+ * Write everything back to the file.
+ */
+void spill_sync (spill_header_t *header, const hashset_t *set)
+{
+    header->count = set->count;
+
+    msync (set->entry, (set->mask + 1) * sizeof (uint64_t), MS_SYNC);
+    msync (header, header_bytes (), MS_SYNC);
+}
+
+
+/*
+ * Sync, unmap and close.
+ */
+void spill_close (spill_header_t *header, hashset_t *set)
+{
+    int fd = set->fd;
+
+    spill_sync (header, set);
+    hashset_free (set);
+    munmap (header, header_bytes ());
+    close (fd);
+}
@@ -0,0 +1,34 @@
+/* First bytes of a spill file, marking it as one */
+#define SPILL_MAGIC     "SZSPILL1"
+
+/*
+ * Spill file header: the progress of a run over a range of seeds, then the
+ * visited-state set for the seed in progress from the next page boundary.
+ */
+typedef struct spill_header_s
+{
+    char magic [8];
+    uint32_t bits;
+    uint32_t first;
+    uint32_t last;
+    uint32_t seed;              /* Seed in progress */
+    uint32_t totals [3];        /* Results of the seeds before it */
+    uint64_t total_nodes;
+    double total_seconds;
+    uint64_t count;             /* Hashes in the set */
+    uint64_t nodes;             /* Nodes searched on the seed in progress */
+    uint64_t children;
+    uint8_t macros;             /* Moves were listed by state_moves_pruned (), as the path must be again */
+    uint8_t interrupted;        /* The set and path below were saved by a clean stop */
+    uint16_t path_length;
+    move_t path [SOLUTION_MAX];
+} spill_header_t;
+
+/* Open or create a spill file and map its set. A file left by an interrupted run keeps its size and contents. */
+spill_header_t *spill_open (const char *path, uint8_t bits, hashset_t *set);
+
+/* Write everything back to the file. */
+void spill_sync (spill_header_t *header, const hashset_t *set);
+
+/* Sync, unmap and close. */
+void spill_close (spill_header_t *header, hashset_t *set);
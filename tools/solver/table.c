@@ -0,0 +1,586 @@
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <immintrin.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "deal.h"
+#include "board.h"
+#include "table.h"
+
+/*
+ * Open addressing with linear probing. An all-zero key marks an empty
+ * entry; no board packs to zero, as every column ends in a non-zero field.
+ */
+
+static bool key_empty (const packed_t *key)
+{
+    return (key->word [0] | key->word [1] | key->word [2] | key->word [3] | key->word [4]) == 0;
+}
+
+
+/*
+ * Allocate a table of 2^bits entries.
+ */
+bool table_init (table_t *table, uint8_t bits)
+{
+    table->entry = calloc ((size_t) 1 << bits, sizeof (packed_t));
+    table->mask = ((uint64_t) 1 << bits) - 1;
+    table->count = 0;
+
+    return table->entry != NULL;
+}
+
+
+/*
+ * Free a table.
+ */
+void table_free (table_t *table)
+{
+    free (table->entry);
+    table->entry = NULL;
+}
+
+
+/*
+ * Forget every key.
+ */
+void table_clear (table_t *table)
+{
+    memset (table->entry, 0, (table->mask + 1) * sizeof (packed_t));
+    table->count = 0;
+}
+
+
+/*
+ * Add a key, unless it is already there. The table is reported full at
+ * 7/8 load, past which probe lengths grow quickly.
+ */
+uint8_t table_insert (table_t *table, const packed_t *key, uint64_t hash)
+{
+    uint64_t i = hash & table->mask;
+
+    while (!key_empty (&table->entry [i]))
+    {
+        if (memcmp (&table->entry [i], key, sizeof (packed_t)) == 0)
+        {
+            return TABLE_PRESENT;
+        }
+        i = (i + 1) & table->mask;
+    }
+
+    if (table->count >= table->mask - (table->mask >> 3))
+    {
+        return TABLE_FULL;
+    }
+
+    table->entry [i] = *key;
+    table->count++;
+
+    return TABLE_ADDED;
+}
+
+
+/*
+ * Hash sets use zero as the empty entry, so a hash of zero is stored as one.
+ * At 8 bytes an entry, a set holds five times the states of a table in the
+ * same memory. Two states sharing a 64-bit hash is unlikely enough to ignore
+ * at the sizes searched here.
+ */
+
+/*
+ * Allocate a set of 2^bits entries.
+ */
+bool hashset_init (hashset_t *set, uint8_t bits)
+{
+    set->entry = calloc ((size_t) 1 << bits, sizeof (uint64_t));
+    set->mask = ((uint64_t) 1 << bits) - 1;
+    set->count = 0;
+    set->fd = -1;
+    set->offset = 0;
+
+    return set->entry != NULL;
+}
+
+
+/*
+ * Map a set onto a file. The caller sizes the file and restores the count.
+ */
+bool hashset_map (hashset_t *set, uint8_t bits, int fd, uint64_t offset)
+{
+    void *entry = mmap (NULL, sizeof (uint64_t) << bits, PROT_READ | PROT_WRITE, MAP_SHARED, fd, offset);
+
+    if (entry == MAP_FAILED)
+    {
+        set->entry = NULL;
+        return false;
+    }
+
+    /* Probes land all over the set, so read-ahead would only waste memory */
+    madvise (entry, sizeof (uint64_t) << bits, MADV_RANDOM);
+
+    set->entry = entry;
+    set->mask = ((uint64_t) 1 << bits) - 1;
+    set->count = 0;
+    set->fd = fd;
+    set->offset = offset;
+
+    return true;
+}
+
+
+/*
+ * Free a set, or unmap it.
+ */
+void hashset_free (hashset_t *set)
+{
+    if (set->fd >= 0)
+    {
+        if (set->entry != NULL)
+        {
+            munmap (set->entry, (set->mask + 1) * sizeof (uint64_t));
+        }
+    }
+    else
+    {
+        free (set->entry);
+    }
+    set->entry = NULL;
+}
+
+
+/*
+ * Forget every hash. A mapped set has its pages punched out of the file,
+ * which reads back as zeros without writing the whole file.
+ */
+void hashset_clear (hashset_t *set)
+{
+    uint64_t bytes = (set->mask + 1) * sizeof (uint64_t);
+
+    if (set->fd < 0 || fallocate (set->fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, set->offset, bytes) != 0)
+    {
+        memset (set->entry, 0, bytes);
+    }
+    set->count = 0;
+}
+
+
+/*
+ * Add a hash, unless it is already there.
+ */
+uint8_t hashset_insert (hashset_t *set, uint64_t hash)
+{
+    uint64_t i;
+
+    hash += (hash == 0);
+    i = (hash ^ (hash >> 32)) & set->mask;
+
+    while (set->entry [i] != 0)
+    {
+        if (set->entry [i] == hash)
+        {
+            return TABLE_PRESENT;
+        }
+        i = (i + 1) & set->mask;
+    }
+
+    if (set->count >= set->mask - (set->mask >> 3))
+    {
+        return TABLE_FULL;
+    }
+
+    set->entry [i] = hash;
+    set->count++;
+
+    return TABLE_ADDED;
+}
+
+
+/*
+ * True if a hash is in the set.
+ */
+bool hashset_contains (const hashset_t *set, uint64_t hash)
+{
+    uint64_t i;
+
+    hash += (hash == 0);
+    i = (hash ^ (hash >> 32)) & set->mask;
+
+    while (set->entry [i] != 0)
+    {
+        if (set->entry [i] == hash)
+        {
+            return true;
+        }
+        i = (i + 1) & set->mask;
+    }
+
+    return false;
+}
+
+
+/*
+ * Batches hide the cost of probing a set much bigger than the cache: the
+ * entry each hash starts at is prefetched a few hashes ahead, so the
+ * misses overlap instead of each stalling in turn. The probe itself looks
+ * at two or four entries per compare with SSE4.1 or AVX2, for the first
+ * that holds the hash or is empty. Near the end of the set, where a load
+ * would run past it, the probe carries on one entry at a time.
+ */
+#define BATCH_AHEAD     8
+
+const char *kernel_names [KERNEL_COUNT] = { "scalar", "sse4.1", "avx2" };
+
+
+/*
+ * Find the first entry from i holding the hash or empty, one at a time.
+ */
+static inline uint64_t find_scalar (const uint64_t *entry, uint64_t mask, uint64_t i, uint64_t hash)
+{
+    while (entry [i] != 0 && entry [i] != hash)
+    {
+        i = (i + 1) & mask;
+    }
+
+    return i;
+}
+
+
+/*
+ * Find the first entry from i holding the hash or empty, two at a time.
+ * Most probes end at the first entry, so that one is checked alone.
+ */
+__attribute__ ((target ("sse4.1")))
+static inline uint64_t find_sse41 (const uint64_t *entry, uint64_t mask, uint64_t i, uint64_t hash)
+{
+    __m128i want = _mm_set1_epi64x (hash);
+    __m128i zero = _mm_setzero_si128 ();
+
+    if (entry [i] == 0 || entry [i] == hash)
+    {
+        return i;
+    }
+    i++;
+
+    while (i + 2 <= mask + 1)
+    {
+        __m128i slots = _mm_loadu_si128 ((const __m128i *) &entry [i]);
+        int hit = _mm_movemask_pd (_mm_castsi128_pd (_mm_or_si128 (_mm_cmpeq_epi64 (slots, want),
+                                                                   _mm_cmpeq_epi64 (slots, zero))));
+        if (hit)
+        {
+            return i + __builtin_ctz (hit);
+        }
+        i += 2;
+    }
+
+    return find_scalar (entry, mask, i & mask, hash);
+}
+
+
+/*
+ * Find the first entry from i holding the hash or empty, four at a time.
+ */
+__attribute__ ((target ("avx2")))
+static inline uint64_t find_avx2 (const uint64_t *entry, uint64_t mask, uint64_t i, uint64_t hash)
+{
+    __m256i want = _mm256_set1_epi64x (hash);
+    __m256i zero = _mm256_setzero_si256 ();
+
+    if (entry [i] == 0 || entry [i] == hash)
+    {
+        return i;
+    }
+    i++;
+
+    while (i + 4 <= mask + 1)
+    {
+        __m256i slots = _mm256_loadu_si256 ((const __m256i *) &entry [i]);
+        int hit = _mm256_movemask_pd (_mm256_castsi256_pd (_mm256_or_si256 (_mm256_cmpeq_epi64 (slots, want),
+                                                                            _mm256_cmpeq_epi64 (slots, zero))));
+        if (hit)
+        {
+            return i + __builtin_ctz (hit);
+        }
+        i += 4;
+    }
+
+    return find_scalar (entry, mask, i & mask, hash);
+}
+
+
+/*
+ * The batch loop, built once for each kernel so its probe is inlined.
+ */
+static inline __attribute__ ((always_inline))
+void insert_batch (hashset_t *set, const uint64_t *hashes, uint8_t *results, uint32_t count,
+                   uint64_t (*find) (const uint64_t *, uint64_t, uint64_t, uint64_t))
+{
+    uint64_t *entry = set->entry;
+    uint64_t mask = set->mask;
+
+    for (uint32_t i = 0; i < count && i < BATCH_AHEAD; i++)
+    {
+        __builtin_prefetch (&entry [(hashes [i] ^ (hashes [i] >> 32)) & mask], 1);
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint64_t hash = hashes [i] + (hashes [i] == 0);
+        uint64_t slot;
+
+        if (i + BATCH_AHEAD < count)
+        {
+            uint64_t ahead = hashes [i + BATCH_AHEAD];
+
+            __builtin_prefetch (&entry [(ahead ^ (ahead >> 32)) & mask], 1);
+        }
+
+        slot = find (entry, mask, (hash ^ (hash >> 32)) & mask, hash);
+
+        if (entry [slot] == hash)
+        {
+            results [i] = TABLE_PRESENT;
+        }
+        else if (set->count >= mask - (mask >> 3))
+        {
+            results [i] = TABLE_FULL;
+        }
+        else
+        {
+            entry [slot] = hash;
+            set->count++;
+            results [i] = TABLE_ADDED;
+        }
+    }
+}
+
+static void insert_batch_scalar (hashset_t *set, const uint64_t *hashes, uint8_t *results, uint32_t count)
+{
+    insert_batch (set, hashes, results, count, find_scalar);
+}
+
+__attribute__ ((target ("sse4.1")))
+static void insert_batch_sse41 (hashset_t *set, const uint64_t *hashes, uint8_t *results, uint32_t count)
+{
+    insert_batch (set, hashes, results, count, find_sse41);
+}
+
+__attribute__ ((target ("avx2")))
+static void insert_batch_avx2 (hashset_t *set, const uint64_t *hashes, uint8_t *results, uint32_t count)
+{
+    insert_batch (set, hashes, results, count, find_avx2);
+}
+
+static void (*batch_kernel) (hashset_t *, const uint64_t *, uint8_t *, uint32_t) = insert_batch_scalar;
+
+
+/*
+ * Pick the kernel for batches.
+ */
+uint8_t hashset_kernel (uint8_t kernel)
+{
+    __builtin_cpu_init ();
+
+    if (kernel >= KERNEL_AVX2 && __builtin_cpu_supports ("avx2"))
+    {
+        batch_kernel = insert_batch_avx2;
+        return KERNEL_AVX2;
+    }
+    if (kernel >= KERNEL_SSE41 && __builtin_cpu_supports ("sse4.1"))
+    {
+        batch_kernel = insert_batch_sse41;
+        return KERNEL_SSE41;
+    }
+
+    batch_kernel = insert_batch_scalar;
+    return KERNEL_SCALAR;
+}
+
+
+/*
+ * Add a batch of hashes, in order.
+ */
+void hashset_insert_batch (hashset_t *set, const uint64_t *hashes, uint8_t *results, uint32_t count)
+{
+    batch_kernel (set, hashes, results, count);
+}
+
+
+/*
+ * Shared sets work like hash sets, but claim an empty entry with a
+ * compare-and-swap, so threads never lock. A thread that loses the race for
+ * an entry looks again at what the winner wrote: the same hash means the
+ * state is already claimed, anything else means probing on. The count is
+ * only used for the 7/8 load limit, so it may run a little behind.
+ */
+
+/*
+ * Allocate a shared set of 2^bits entries.
+ */
+bool sharedset_init (sharedset_t *set, uint8_t bits)
+{
+    set->entry = calloc ((size_t) 1 << bits, sizeof (uint64_t));
+    set->mask = ((uint64_t) 1 << bits) - 1;
+    atomic_init (&set->count, 0);
+
+    return set->entry != NULL;
+}
+
+
+/*
+ * Free a shared set.
+ */
+void sharedset_free (sharedset_t *set)
+{
+    free ((void *) set->entry);
+    set->entry = NULL;
+}
+
+
+/*
+ * Forget every hash.
+ */
+void sharedset_clear (sharedset_t *set)
+{
+    memset ((void *) set->entry, 0, (set->mask + 1) * sizeof (uint64_t));
+    atomic_store (&set->count, 0);
+}
+
+
+/*
+ * Add a hash, unless it is already there.
+ */
+uint8_t sharedset_insert (sharedset_t *set, uint64_t hash)
+{
+    uint64_t i;
+
+    hash += (hash == 0);
+    i = (hash ^ (hash >> 32)) & set->mask;
+
+    for (;;)
+    {
+        uint64_t seen = atomic_load_explicit (&set->entry [i], memory_order_relaxed);
+
+        if (seen == 0)
+        {
+            if (atomic_load_explicit (&set->count, memory_order_relaxed) >= set->mask - (set->mask >> 3))
+            {
+                return TABLE_FULL;
+            }
+
+            if (atomic_compare_exchange_strong_explicit (&set->entry [i], &seen, hash,
+                                                         memory_order_relaxed, memory_order_relaxed))
+            {
+                atomic_fetch_add_explicit (&set->count, 1, memory_order_relaxed);
+                return TABLE_ADDED;
+            }
+        }
+
+        if (seen == hash)
+        {
+            return TABLE_PRESENT;
+        }
+        i = (i + 1) & set->mask;
+    }
+}
+
+
+/*
+ * Cost tables are four-way set associative and never grow. When a set is
+ * full, the entry reached at the highest cost is replaced, as the entries
+ * nearest the root prune the most. A lost entry only costs repeated work.
+ * Entries from earlier iterations count as empty, so starting an iteration
+ * doesn't touch memory.
+ */
+#define COSTTABLE_WAYS  4
+
+/*
+ * Allocate the largest table that fits in the given number of bytes.
+ */
+bool costtable_init (costtable_t *table, uint64_t bytes)
+{
+    uint64_t entries = COSTTABLE_WAYS;
+
+    while (entries * 2 * sizeof (costentry_t) <= bytes)
+    {
+        entries *= 2;
+    }
+
+    table->entry = calloc (entries, sizeof (costentry_t));
+    table->mask = (entries - 1) & ~(uint64_t) (COSTTABLE_WAYS - 1);
+    table->iteration = 0;
+
+    return table->entry != NULL;
+}
+
+
+/*
+ * Free a table.
+ */
+void costtable_free (costtable_t *table)
+{
+    free (table->entry);
+    table->entry = NULL;
+}
+
+
+/*
+ * Start a new iteration.
+ */
+void costtable_next (costtable_t *table)
+{
+    /* Iteration zero marks an empty entry, so wipe the table when the count wraps */
+    if (++table->iteration == 0)
+    {
+        memset (table->entry, 0, (table->mask + COSTTABLE_WAYS) * sizeof (costentry_t));
+        table->iteration = 1;
+    }
+}
+
+
+/*
+ * Record reaching a state at a cost.
+ */
+bool costtable_visit (costtable_t *table, uint64_t hash, uint16_t cost)
+{
+    costentry_t *set = &table->entry [(hash ^ (hash >> 32)) & table->mask];
+    costentry_t *victim = &set [0];
+
+    for (uint8_t way = 0; way < COSTTABLE_WAYS; way++)
+    {
+        costentry_t *entry = &set [way];
+
+        if (entry->iteration != table->iteration)
+        {
+            victim = entry;
+            victim->cost = 0xffff;
+            break;
+        }
+
+        if (entry->hash == hash)
+        {
+            if (entry->cost <= cost)
+            {
+                return false;
+            }
+            entry->cost = cost;
+            return true;
+        }
+
+        if (entry->cost > victim->cost)
+        {
+            victim = entry;
+        }
+    }
+
+    victim->hash = hash;
+    victim->cost = cost;
+    victim->iteration = table->iteration;
+
+    return true;
+}
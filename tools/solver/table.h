@@ -0,0 +1,113 @@
+/* Transposition table: the set of canonical keys already searched. */
+typedef struct table_s
+{
+    packed_t *entry;
+    uint64_t mask;
+    uint64_t count;
+} table_t;
+
+/* Allocate a table of 2^bits entries. Returns false if out of memory. */
+bool table_init (table_t *table, uint8_t bits);
+
+/* Free a table. */
+void table_free (table_t *table);
+
+/* Forget every key. */
+void table_clear (table_t *table);
+
+/* Results of table_insert () */
+#define TABLE_ADDED     0
+#define TABLE_PRESENT   1
+#define TABLE_FULL      2
+
+/* Add a key, unless it is already there. */
+uint8_t table_insert (table_t *table, const packed_t *key, uint64_t hash);
+
+/* Set of 64-bit board hashes, for searches that trust the hash alone. */
+typedef struct hashset_s
+{
+    uint64_t *entry;
+    uint64_t mask;
+    uint64_t count;
+    int fd;             /* Backing file when mapped, otherwise -1 */
+    uint64_t offset;
+} hashset_t;
+
+/* Allocate a set of 2^bits entries. Returns false if out of memory. */
+bool hashset_init (hashset_t *set, uint8_t bits);
+
+/* Map a set of 2^bits entries onto a file at a page-aligned offset, keeping what the file holds. */
+bool hashset_map (hashset_t *set, uint8_t bits, int fd, uint64_t offset);
+
+/* Free a set, or unmap it. */
+void hashset_free (hashset_t *set);
+
+/* Forget every hash. */
+void hashset_clear (hashset_t *set);
+
+/* Add a hash, unless it is already there. Returns TABLE_ADDED, TABLE_PRESENT or TABLE_FULL. */
+uint8_t hashset_insert (hashset_t *set, uint64_t hash);
+
+/* True if a hash is in the set. */
+bool hashset_contains (const hashset_t *set, uint64_t hash);
+
+/* Kernels for hashset_insert_batch () */
+#define KERNEL_SCALAR   0
+#define KERNEL_SSE41    1
+#define KERNEL_AVX2     2
+#define KERNEL_COUNT    3
+
+extern const char *kernel_names [KERNEL_COUNT];
+
+/* Pick the kernel for batches, if the CPU has it. Returns the best kernel the CPU has, at most the one asked for. */
+uint8_t hashset_kernel (uint8_t kernel);
+
+/* Add a batch of hashes, in order, as hashset_insert () would one at a time. */
+void hashset_insert_batch (hashset_t *set, const uint64_t *hashes, uint8_t *results, uint32_t count);
+
+/* Hash set that many threads may add to at once, lock-free. */
+typedef struct sharedset_s
+{
+    _Atomic uint64_t *entry;
+    uint64_t mask;
+    atomic_uint_fast64_t count;
+} sharedset_t;
+
+/* Allocate a shared set of 2^bits entries. Returns false if out of memory. */
+bool sharedset_init (sharedset_t *set, uint8_t bits);
+
+/* Free a shared set. */
+void sharedset_free (sharedset_t *set);
+
+/* Forget every hash. Not safe while other threads are adding. */
+void sharedset_clear (sharedset_t *set);
+
+/* Add a hash, unless it is already there. Returns TABLE_ADDED to exactly one of any threads adding the same hash. */
+uint8_t sharedset_insert (sharedset_t *set, uint64_t hash);
+
+/* Cheapest path cost seen for each state in the current IDA* iteration, in a fixed amount of memory. */
+typedef struct costentry_s
+{
+    uint64_t hash;
+    uint16_t cost;
+    uint16_t iteration;
+} costentry_t;
+
+typedef struct costtable_s
+{
+    costentry_t *entry;
+    uint64_t mask;
+    uint16_t iteration;
+} costtable_t;
+
+/* Allocate the largest table that fits in the given number of bytes. */
+bool costtable_init (costtable_t *table, uint64_t bytes);
+
+/* Free a table. */
+void costtable_free (costtable_t *table);
+
+/* Start a new iteration, forgetting every cost. */
+void costtable_next (costtable_t *table);
+
+/* Record reaching a state at a cost. Returns false if it was already reached as cheaply this iteration. */
+bool costtable_visit (costtable_t *table, uint64_t hash, uint16_t cost);
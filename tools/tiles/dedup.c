@@ -0,0 +1,105 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "pack.h"
+#include "dedup.h"
+
+/*
+ * Tile deduplication. Outlines and buttons are drawn from mirrored corners
+ * and halves, so many tiles are another tile flipped, which the VDP can do
+ * for free from the name table. Sprites can't be flipped, though, so tiles
+ * that are also drawn as sprites are only ever kept.
+ */
+
+
+/*
+ * Reverse the bits of a byte, for a horizontal flip.
+ */
+static uint8_t reverse (uint8_t byte)
+{
+    byte = (byte >> 4) | (byte << 4);
+    byte = ((byte & 0xcc) >> 2) | ((byte & 0x33) << 2);
+    byte = ((byte & 0xaa) >> 1) | ((byte & 0x55) << 1);
+
+    return byte;
+}
+
+
+/*
+ * Draw a tile as a name table entry would show it.
+ */
+void flip_tile (const uint8_t *tile, uint16_t entry, uint8_t *out)
+{
+    for (uint8_t row = 0; row < 8; row++)
+    {
+        uint8_t from = (entry & ENTRY_FLIP_Y) ? 7 - row : row;
+
+        for (uint8_t plane = 0; plane < 4; plane++)
+        {
+            uint8_t byte = tile [from * 4 + plane];
+
+            out [row * 4 + plane] = (entry & ENTRY_FLIP_X) ? reverse (byte) : byte;
+        }
+    }
+}
+
+
+/*
+ * Find a kept tile that a tile repeats, as it is or flipped. Returns its
+ * name table entry, or 0xffff if there is none.
+ */
+static uint16_t find_repeat (const uint8_t *tiles, uint16_t kept, const uint8_t *tile)
+{
+    static const uint16_t flip_entries [4] = { 0, ENTRY_FLIP_X, ENTRY_FLIP_Y, ENTRY_FLIP_X | ENTRY_FLIP_Y };
+
+    for (uint16_t k = 0; k < kept; k++)
+    {
+        for (uint8_t f = 0; f < 4; f++)
+        {
+            uint8_t flipped [TILE_BYTES];
+
+            flip_tile (&tiles [k * TILE_BYTES], flip_entries [f], flipped);
+            if (memcmp (flipped, tile, TILE_BYTES) == 0)
+            {
+                return k | flip_entries [f];
+            }
+        }
+    }
+
+    return 0xffff;
+}
+
+
+/*
+ * Drop each tile from (first) on that repeats a kept tile.
+ */
+uint16_t dedup_tiles (uint8_t *tiles, uint16_t count, uint16_t first, uint16_t *entries, dedup_stats_t *stats)
+{
+    uint16_t kept = 0;
+
+    for (uint16_t t = 0; t < count; t++)
+    {
+        uint8_t tile [TILE_BYTES];
+        uint16_t entry;
+
+        memcpy (tile, &tiles [t * TILE_BYTES], TILE_BYTES);
+        entry = find_repeat (tiles, kept, tile);
+
+        if (t >= first && entry != 0xffff)
+        {
+            entries [t] = entry;
+            stats->same += (entry & (ENTRY_FLIP_X | ENTRY_FLIP_Y)) == 0;
+            stats->flipped += (entry & (ENTRY_FLIP_X | ENTRY_FLIP_Y)) != 0;
+            continue;
+        }
+
+        stats->sprite_repeats += (entry != 0xffff);
+        memcpy (&tiles [kept * TILE_BYTES], tile, TILE_BYTES);
+        entries [t] = kept++;
+    }
+
+    stats->kept = kept;
+
+    return kept;
+}
@@ -0,0 +1,21 @@
+/* Name table entry bits: the tile, and flips, as SMSlib's TILE_FLIPPED_X and TILE_FLIPPED_Y */
+#define ENTRY_FLIP_X    0x0200
+#define ENTRY_FLIP_Y    0x0400
+#define ENTRY_TILE      0x01ff
+
+/* Tiles kept and dropped, and how the dropped ones are drawn instead */
+typedef struct dedup_stats_s
+{
+    uint32_t kept;
+    uint32_t same;
+    uint32_t flipped;
+    uint32_t sprite_repeats;
+} dedup_stats_t;
+
+/* Drop each tile from (first) on that repeats a kept tile, as it is or flipped, closing up the
+ * tiles in place. Tiles before (first) are all kept. Fills in a name table entry for every tile,
+ * and returns the number kept. */
+uint16_t dedup_tiles (uint8_t *tiles, uint16_t count, uint16_t first, uint16_t *entries, dedup_stats_t *stats);
+
+/* Draw a tile as a name table entry would show it. */
+void flip_tile (const uint8_t *tile, uint16_t entry, uint8_t *out);
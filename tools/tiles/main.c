@@ -0,0 +1,333 @@
+/*
+ * Shenzhen Solitaire Game Gear - tile packer
+ *
+ * Host-side tool that reads the cartridge's tile patterns from C source,
+ * drops those that repeat another tile the name table can flip, packs the
+ * rest for tiles_unpack (), checks that they unpack to the same tiles, and
+ * writes them out as C source for the cartridge.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "pack.h"
+#include "dedup.h"
+
+/* More than the VDP's 512 tiles, so any pattern set fits */
+#define TILES_MAX       512
+
+
+static void usage (void)
+{
+    fprintf (stderr,
+             "Usage: tiles [options] PATTERNS.c\n"
+             "  -f TILE        First tile that may be drawn from another, flipped; the tiles before it\n"
+             "                 are drawn as sprites, and kept (default: keep every tile)\n"
+             "  -n NAME        Name of the array to read (default patterns)\n"
+             "  -o FILE        Write the packed tiles as C source (such as source/patterns_packed.c)\n");
+    exit (EXIT_FAILURE);
+}
+
+
+/*
+ * Read the 32-bit words of an array from C source, a row of a tile each,
+ * into bytes in the order they go to VRAM. Returns the number of tiles.
+ */
+static uint16_t read_patterns (const char *path, const char *name, uint8_t *tiles)
+{
+    FILE *file = fopen (path, "r");
+    char *text;
+    char *p;
+    long size;
+    uint32_t words = 0;
+    bool comment = false;
+
+    if (file == NULL)
+    {
+        perror (path);
+        exit (EXIT_FAILURE);
+    }
+
+    fseek (file, 0, SEEK_END);
+    size = ftell (file);
+    rewind (file);
+    text = calloc (size + 1, 1);
+    if (text == NULL || fread (text, 1, size, file) != (size_t) size)
+    {
+        fprintf (stderr, "%s: can't read\n", path);
+        exit (EXIT_FAILURE);
+    }
+    fclose (file);
+
+    /* The array's opening brace */
+    p = text;
+    while ((p = strstr (p, name)) != NULL)
+    {
+        char *after = p + strlen (name);
+
+        if ((p == text || !(p [-1] == '_' || (p [-1] >= 'a' && p [-1] <= 'z'))) && strspn (after, " []") > 0 &&
+            strchr (after, '{') != NULL && strchr (after, '{') < strchr (after, ';'))
+        {
+            p = strchr (after, '{') + 1;
+            break;
+        }
+        p = after;
+    }
+    if (p == NULL)
+    {
+        fprintf (stderr, "%s: no array %s\n", path, name);
+        exit (EXIT_FAILURE);
+    }
+
+    /* Its words, up to the closing brace, passing over comments */
+    while (*p != '\0' && (comment || *p != '}'))
+    {
+        if (comment)
+        {
+            comment = !(p [0] == '*' && p [1] == '/');
+            p += comment ? 1 : 2;
+        }
+        else if (p [0] == '/' && p [1] == '*')
+        {
+            comment = true;
+            p += 2;
+        }
+        else if (p [0] == '/' && p [1] == '/')
+        {
+            p += strcspn (p, "\n");
+        }
+        else if (p [0] == '0' && (p [1] == 'x' || p [1] == 'X'))
+        {
+            uint32_t word = strtoul (p, &p, 16);
+
+            if (words == TILES_MAX * 8)
+            {
+                fprintf (stderr, "%s: more than %u tiles\n", path, TILES_MAX);
+                exit (EXIT_FAILURE);
+            }
+
+            /* Little-endian, as the Z80 keeps it: plane 0 first */
+            for (uint8_t plane = 0; plane < 4; plane++)
+            {
+                tiles [words * 4 + plane] = word >> (8 * plane);
+            }
+            words++;
+        }
+        else
+        {
+            p++;
+        }
+    }
+
+    free (text);
+
+    if (words % 8 != 0)
+    {
+        fprintf (stderr, "%s: %u words is not a whole number of tiles\n", path, words);
+        exit (EXIT_FAILURE);
+    }
+
+    return words / 8;
+}
+
+
+/*
+ * Write the packed tiles as C source, to be included by the cartridge's main.c.
+ */
+static bool write_packed (const char *path, const char *command, const uint8_t *packed, const pack_stats_t *stats,
+                          const uint16_t *entries, uint16_t count, uint16_t first, uint32_t first_offset)
+{
+    uint16_t kept = 0;
+    bool closed = false;
+    FILE *file = fopen (path, "w");
+
+    if (file == NULL)
+    {
+        perror (path);
+        return false;
+    }
+
+    fprintf (file, "/*\n"
+                   " * Tile patterns for tiles_unpack (), generated by\n"
+                   " *   %s\n"
+                   " * %u tiles kept, %u bytes packed into %u (%.1f%%).\n"
+                   " */\n\n", command, stats->tiles, stats->bytes_in, stats->bytes_out,
+                   100.0 * stats->bytes_out / stats->bytes_in);
+
+    fprintf (file, "#define PATTERN_TILES %u\n\n", stats->tiles);
+
+    /* Nothing before -f is dropped, so those tiles can be loaded on their own */
+    fprintf (file, "/* First background-only tile, and where its packed data starts, to load them on their own */\n"
+                   "#define PATTERN_BACKGROUND_TILE %u\n"
+                   "#define PATTERN_BACKGROUND_OFFSET %u\n\n", first, first_offset);
+
+    /* Runs of kept tiles that move down together, and each dropped tile on its own */
+    fprintf (file, "/* Name table entry for tile (n) of patterns.c, as a constant: the tile it is kept as, and any flips */\n"
+                   "#define PATTERN_ENTRY(n) ( \\\n");
+    for (uint16_t t = 0; t < count;)
+    {
+        uint16_t end = t;
+        char offset [16] = "";
+
+        if (entries [t] != kept)
+        {
+            fprintf (file, "    (n) == %u ? (%u%s%s) : \\\n", t, entries [t] & ENTRY_TILE,
+                     (entries [t] & ENTRY_FLIP_X) ? " | TILE_FLIPPED_X" : "",
+                     (entries [t] & ENTRY_FLIP_Y) ? " | TILE_FLIPPED_Y" : "");
+            t++;
+            continue;
+        }
+
+        while (end < count && entries [end] == kept + end - t)
+        {
+            end++;
+        }
+        if (t > kept)
+        {
+            snprintf (offset, sizeof (offset), " - %u", t - kept);
+        }
+
+        if (end < count)
+        {
+            fprintf (file, "    (n) < %u ? (n)%s : \\\n", end, offset);
+        }
+        else
+        {
+            fprintf (file, "    (n)%s)\n\n", offset);
+            closed = true;
+        }
+        kept += end - t;
+        t = end;
+    }
+    if (!closed)
+    {
+        fprintf (file, "    0)\n\n");
+    }
+
+    fprintf (file, "const uint8_t patterns_packed [%u] = {", stats->bytes_out);
+    for (uint32_t i = 0; i < stats->bytes_out; i++)
+    {
+        fprintf (file, "%s0x%02x%s", (i % 12) ? " " : "\n    ", packed [i], (i + 1 < stats->bytes_out) ? "," : "\n");
+    }
+    fprintf (file, "};\n");
+
+    if (fclose (file) != 0)
+    {
+        perror (path);
+        return false;
+    }
+
+    return true;
+}
+
+
+int main (int argc, char **argv)
+{
+    static uint8_t tiles [TILES_MAX * TILE_BYTES];
+    static uint8_t kept [TILES_MAX * TILE_BYTES];
+    static uint8_t unpacked [TILES_MAX * TILE_BYTES];
+    static uint8_t packed [TILES_MAX * PACKED_MAX];
+    static uint16_t entries [TILES_MAX];
+    pack_stats_t stats = { 0 };
+    dedup_stats_t dedup_stats = { 0 };
+    const char *name = "patterns";
+    const char *out_path = NULL;
+    char command [256] = "tiles";
+    uint16_t first = TILES_MAX;
+    uint16_t count;
+    uint16_t kept_count;
+    uint32_t first_offset = 0;
+    uint32_t in = 0;
+    int opt;
+
+    while ((opt = getopt (argc, argv, "f:n:o:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'f':
+                first = strtoul (optarg, NULL, 0);
+                break;
+            case 'n':
+                name = optarg;
+                break;
+            case 'o':
+                out_path = optarg;
+                break;
+            default:
+                usage ();
+        }
+    }
+    if (optind + 1 != argc)
+    {
+        usage ();
+    }
+
+    count = read_patterns (argv [optind], name, tiles);
+
+    if (first > count)
+    {
+        first = count;
+    }
+
+    memcpy (kept, tiles, count * TILE_BYTES);
+    kept_count = dedup_tiles (kept, count, first, entries, &dedup_stats);
+
+    for (uint16_t t = 0; t < kept_count; t++)
+    {
+        if (t == first)
+        {
+            first_offset = stats.bytes_out;
+        }
+        pack_tile (&kept [t * TILE_BYTES], &packed [stats.bytes_out], &stats);
+    }
+    if (first == kept_count)
+    {
+        first_offset = stats.bytes_out;
+    }
+
+    /* Check the round trip, each tile as its name table entry draws it */
+    for (uint16_t t = 0; t < kept_count; t++)
+    {
+        in += unpack_tile (&packed [in], &unpacked [t * TILE_BYTES]);
+    }
+    for (uint16_t t = 0; t < count; t++)
+    {
+        uint8_t tile [TILE_BYTES];
+
+        flip_tile (&unpacked [(entries [t] & ENTRY_TILE) * TILE_BYTES], entries [t], tile);
+        if (memcmp (tile, &tiles [t * TILE_BYTES], TILE_BYTES) != 0)
+        {
+            fprintf (stderr, "Tile %u does not unpack to itself\n", t);
+            return EXIT_FAILURE;
+        }
+    }
+
+    printf ("%u tiles: %u kept, %u dropped as repeats and %u as flips; %u more repeat others but are drawn as sprites\n",
+            count, dedup_stats.kept, dedup_stats.same, dedup_stats.flipped, dedup_stats.sprite_repeats);
+
+    printf ("%u tiles: %u bytes packed into %u (%.1f%%), %u bytes of ROM saved\n", stats.tiles, stats.bytes_in,
+            stats.bytes_out, 100.0 * stats.bytes_out / stats.bytes_in, stats.bytes_in - stats.bytes_out);
+    printf ("Bitplanes: %u blank, %u solid, %u copied, %u masked with %u literals\n", stats.planes [PLANE_ZERO],
+            stats.planes [PLANE_ONES], stats.planes [PLANE_COPY], stats.planes [PLANE_MASKED], stats.literals);
+
+    if (out_path != NULL)
+    {
+        /* The command goes in the file, so it can be made again */
+        for (int i = 1; i < argc; i++)
+        {
+            strncat (command, " ", sizeof (command) - strlen (command) - 1);
+            strncat (command, argv [i], sizeof (command) - strlen (command) - 1);
+        }
+
+        if (!write_packed (out_path, command, packed, &stats, entries, count, first, first_offset))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,151 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "pack.h"
+
+/*
+ * Tile packing, a bitplane at a time. Card art is mostly flat colour with
+ * outlines, so a plane is often blank, solid, or another plane of the same
+ * tile (or its inverse), and otherwise changes on only a few of its rows.
+ */
+
+
+/*
+ * Pack one tile.
+ */
+uint8_t pack_tile (const uint8_t *tile, uint8_t *out, pack_stats_t *stats)
+{
+    uint8_t length = 1;
+    uint8_t ops = 0;
+
+    for (uint8_t plane = 0; plane < 4; plane++)
+    {
+        uint8_t rows [8];
+        bool zero = true;
+        bool ones = true;
+        uint8_t op = PLANE_MASKED;
+
+        for (uint8_t row = 0; row < 8; row++)
+        {
+            rows [row] = tile [row * 4 + plane];
+            zero &= (rows [row] == 0x00);
+            ones &= (rows [row] == 0xff);
+        }
+
+        if (zero)
+        {
+            op = PLANE_ZERO;
+        }
+        else if (ones)
+        {
+            op = PLANE_ONES;
+        }
+        else
+        {
+            /* Another plane, as is or inverted */
+            for (uint8_t earlier = 0; earlier < plane && op == PLANE_MASKED; earlier++)
+            {
+                for (uint8_t invert = 0; invert < 2; invert++)
+                {
+                    uint8_t flip = invert ? 0xff : 0x00;
+                    bool same = true;
+
+                    for (uint8_t row = 0; row < 8; row++)
+                    {
+                        same &= (rows [row] == (tile [row * 4 + earlier] ^ flip));
+                    }
+
+                    if (same)
+                    {
+                        op = PLANE_COPY;
+                        out [length++] = earlier | (invert << 7);
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (op == PLANE_MASKED)
+        {
+            uint8_t *mask = &out [length++];
+            uint8_t previous = 0x00;
+
+            *mask = 0;
+            for (uint8_t row = 0; row < 8; row++)
+            {
+                if (rows [row] != previous)
+                {
+                    *mask |= 0x80 >> row;
+                    out [length++] = rows [row];
+                    previous = rows [row];
+                    stats->literals++;
+                }
+            }
+        }
+
+        ops = (ops << 2) | op;
+        stats->planes [op]++;
+    }
+
+    out [0] = ops;
+
+    stats->tiles++;
+    stats->bytes_in += TILE_BYTES;
+    stats->bytes_out += length;
+
+    return length;
+}
+
+
+/*
+ * Unpack one tile.
+ */
+uint8_t unpack_tile (const uint8_t *in, uint8_t *tile)
+{
+    uint8_t length = 1;
+    uint8_t ops = in [0];
+
+    for (uint8_t plane = 0; plane < 4; plane++)
+    {
+        uint8_t value = 0x00;
+        uint8_t arg;
+
+        switch (ops >> 6)
+        {
+            case PLANE_ZERO:
+            case PLANE_ONES:
+                value = ((ops >> 6) == PLANE_ONES) ? 0xff : 0x00;
+                for (uint8_t row = 0; row < 8; row++)
+                {
+                    tile [row * 4 + plane] = value;
+                }
+                break;
+
+            case PLANE_COPY:
+                arg = in [length++];
+                value = (arg & 0x80) ? 0xff : 0x00;
+                for (uint8_t row = 0; row < 8; row++)
+                {
+                    tile [row * 4 + plane] = tile [row * 4 + (arg & 0x03)] ^ value;
+                }
+                break;
+
+            case PLANE_MASKED:
+                arg = in [length++];
+                for (uint8_t row = 0; row < 8; row++)
+                {
+                    if (arg & (0x80 >> row))
+                    {
+                        value = in [length++];
+                    }
+                    tile [row * 4 + plane] = value;
+                }
+                break;
+        }
+
+        ops <<= 2;
+    }
+
+    return length;
+}
@@ -0,0 +1,27 @@
+/* Bytes in one 8x8 tile of four bitplanes, as the VDP stores it: a row at a time, planes 0-3 */
+#define TILE_BYTES      32
+
+/* Most bytes one tile can pack into */
+#define PACKED_MAX      (1 + 4 * 9)
+
+/* Bitplane encodings, two bits each in a tile's first byte, plane 0 in the top bits */
+#define PLANE_ZERO      0   /* Every row 0x00 */
+#define PLANE_ONES      1   /* Every row 0xff */
+#define PLANE_COPY      2   /* An earlier plane of the tile: one byte, its index, with bit 7 set if inverted */
+#define PLANE_MASKED    3   /* A mask byte, row 0 in bit 7, then a literal for each set bit; other rows repeat the row above */
+
+/* Planes packed with each encoding, and bytes in and out */
+typedef struct pack_stats_s
+{
+    uint32_t tiles;
+    uint32_t bytes_in;
+    uint32_t bytes_out;
+    uint32_t planes [4];
+    uint32_t literals;
+} pack_stats_t;
+
+/* Pack one tile. Returns the number of bytes written to (out). */
+uint8_t pack_tile (const uint8_t *tile, uint8_t *out, pack_stats_t *stats);
+
+/* Unpack one tile, as the cartridge's tiles.c does. Returns the number of bytes read from (in). */
+uint8_t unpack_tile (const uint8_t *in, uint8_t *tile);